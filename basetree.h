@@ -68,6 +68,20 @@
 #define ENABLE_DEBUG_COMPARE 0
 #endif
 
+#if !defined(COMPARECACHESIZE)
+/**
+ * @date 2022-03-14 00:51:20
+ *
+ * Number of entries in the direct-mapped result cache of `baseTree_t::compare()`, must be a power of 2.
+ * Node pairs recur constantly during normalisation.
+ * Nodes are immutable once created, results stay valid until the tree is rewound.
+ * Zero disables the cache.
+ *
+ * @constant {number} COMPARECACHESIZE
+ */
+#define COMPARECACHESIZE 65536
+#endif
+
 /*
  * The top-level node rewriting is a level-2 normalisation replacement that examines Q/T?F components
  * This is a speed optimisation and enables code to display the decisions taken while walking.
@@ -135,6 +149,18 @@ struct baseTreeHeader_t {
 	uint64_t offEnd;
 };
 
+/*
+ * @date 2022-03-14 00:51:47
+ *
+ * Entry of the `baseTree_t::compare()` result cache
+ */
+struct baseCompareEntry_t {
+	uint32_t lhs;                 // left-hand-side node id
+	uint32_t rhs;                 // right-hand-side node id
+	uint32_t version;             // `(version << 3) | topLevelCascade`, zero for empty
+	int32_t  result;              // result of compare
+};
+
 struct baseTree_t {
 
 	/*
@@ -147,12 +173,14 @@ struct baseTree_t {
 		ALLOCFLAG_ROOTS,	// roots
 		ALLOCFLAG_HISTORY,	// history
 		ALLOCFLAG_INDEX,	// node index/lookup table
+		ALLOCFLAG_RAWDATA,	// file contents read into memory
 
 		ALLOCMASK_NAMES   = 1 << ALLOCFLAG_NAMES,
 		ALLOCMASK_NODES   = 1 << ALLOCFLAG_NODES,
 		ALLOCMASK_ROOTS   = 1 << ALLOCFLAG_ROOTS,
 		ALLOCMASK_HISTORY = 1 << ALLOCFLAG_HISTORY,
 		ALLOCMASK_INDEX   = 1 << ALLOCFLAG_INDEX,
+		ALLOCMASK_RAWDATA = 1 << ALLOCFLAG_RAWDATA,
 		//@formatter:on
 	};
 	
@@ -208,11 +236,15 @@ struct baseTree_t {
 	uint32_t                 *compVersionR;
 	uint32_t                 compVersionNr;         // versioned memory for compare - active version number
 	uint64_t                 numCompare;            // number of compares performed
+	baseCompareEntry_t       *compareCache;         // cached compare results, see `COMPARECACHESIZE`
+	uint32_t                 compareCacheVersionNr; // active version number, bumped on rewind
 	// rewrite normalisation
 	uint32_t                 *rewriteMap;           // results of intermediate lookups
 	uint32_t                 *rewriteVersion;       // versioned memory for rewrites
 	uint32_t                 iVersionRewrite;       // active version number
 	uint64_t                 numRewrite;            // number of rewrites performed
+	// reference counting
+	uint32_t                 *refCount;             // optional live reference counts, see `enableRefCount()`
 
 	/**
 	 * @date 2021-06-13 00:01:50
@@ -274,11 +306,15 @@ struct baseTree_t {
 		compVersionR(NULL),  // allocate as node-id map because of local version numbering
 		compVersionNr(1),
 		numCompare(0),
+		compareCache(NULL),
+		compareCacheVersionNr(1),
 		// rewrite normalisation
 		rewriteMap(NULL),
 		rewriteVersion(NULL),
 		iVersionRewrite(1),
-		numRewrite(0) {
+		numRewrite(0),
+		// reference counting
+		refCount(NULL) {
 	}
 
 	/*
@@ -315,8 +351,8 @@ struct baseTree_t {
 		history((uint32_t *) ctx.myAlloc("baseTree_t::history", nstart, sizeof *history)),
 		// node index  NOTE: reserve 4G for the node+version index
 		nodeIndexSize(536870879), // first prime number before 0x20000000-8 (so that 4*this does not exceed 0x80000000-32),
-		nodeIndex((uint32_t *) ctx.myAlloc("baseTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
-		nodeIndexVersion((uint32_t *) ctx.myAlloc("baseTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
+		nodeIndex((uint32_t *) ctx.myAllocLazy("baseTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
+		nodeIndexVersion((uint32_t *) ctx.myAllocLazy("baseTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
 		nodeIndexVersionNr(1), // own version because longer life span
 		// pools
 		numPoolMap(0),
@@ -333,11 +369,15 @@ struct baseTree_t {
 		compVersionR(allocMap()),  // allocate as node-id map because of local version numbering
 		compVersionNr(1),
 		numCompare(0),
+		compareCache(COMPARECACHESIZE ? (baseCompareEntry_t *) ctx.myAlloc("baseTree_t::compareCache", COMPARECACHESIZE, sizeof(*compareCache)) : NULL),
+		compareCacheVersionNr(1),
 		// rewrite normalisation
 		rewriteMap(allocMap()),
 		rewriteVersion(allocMap()), // allocate as node-id map because of local version numbering
 		iVersionRewrite(1),
-		numRewrite(0)
+		numRewrite(0),
+		// reference counting
+		refCount(NULL)
 	//@formatter:on
 	{
 		if (this->N)
@@ -405,8 +445,8 @@ struct baseTree_t {
 		history((uint32_t *) ctx.myAlloc("baseTree_t::history", nstart, sizeof *history)),
 		// node index  NOTE: reserve 4G for the node+version index
 		nodeIndexSize(536870879), // first prime number before 0x20000000-8 (so that 4*this does not exceed 0x80000000-32),
-		nodeIndex((uint32_t *) ctx.myAlloc("baseTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
-		nodeIndexVersion((uint32_t *) ctx.myAlloc("baseTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
+		nodeIndex((uint32_t *) ctx.myAllocLazy("baseTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
+		nodeIndexVersion((uint32_t *) ctx.myAllocLazy("baseTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
 		nodeIndexVersionNr(1), // own version because longer life span
 		// pools
 		numPoolMap(0),
@@ -423,11 +463,15 @@ struct baseTree_t {
 		compVersionR(allocMap()),  // allocate as node-id map because of local version numbering
 		compVersionNr(1),
 		numCompare(0),
+		compareCache(COMPARECACHESIZE ? (baseCompareEntry_t *) ctx.myAlloc("baseTree_t::compareCache", COMPARECACHESIZE, sizeof(*compareCache)) : NULL),
+		compareCacheVersionNr(1),
 		// rewrite normalisation
 		rewriteMap(allocMap()),
 		rewriteVersion(allocMap()), // allocate as node-id map because of local version numbering
 		iVersionRewrite(1),
-		numRewrite(0)
+		numRewrite(0),
+		// reference counting
+		refCount(NULL)
 	//@formatter:on
 	{
 		/*
@@ -452,8 +496,8 @@ struct baseTree_t {
 			N[iEntry].F = iEntry;
 		}
 
-		// load string with separate roots
-		uint32_t *pRoots = allocMap();
+		// load string with separate roots, there are no more roots than characters
+		uint32_t *pRoots = (uint32_t *) ctx.myAlloc("baseTree_t::pRoots", strlen(pName) + 1, sizeof *pRoots);
 
 		if (pTransform) {
 			this->numRoots = this->loadStringSafe(pName, pTransform + 1, pRoots);
@@ -494,7 +538,7 @@ struct baseTree_t {
 			this->roots[iRoot] = pRoots[iRoot];
 		}
 
-		freeMap(pRoots);
+		ctx.myFree("baseTree_t::pRoots", pRoots);
 
 		/*
 		 * finalise
@@ -522,8 +566,8 @@ struct baseTree_t {
 		if (allocFlags & ALLOCMASK_HISTORY)
 			ctx.myFree("baseTree_t::history", this->history);
 		if (allocFlags & ALLOCMASK_INDEX) {
-			ctx.myFree("baseTree_t::nodeIndex", this->nodeIndex);
-			ctx.myFree("baseTree_t::nodeIndexVersion", this->nodeIndexVersion);
+			ctx.myFreeLazy("baseTree_t::nodeIndex", this->nodeIndex, nodeIndexSize, sizeof(*nodeIndex));
+			ctx.myFreeLazy("baseTree_t::nodeIndexVersion", this->nodeIndexVersion, nodeIndexSize, sizeof(*nodeIndexVersion));
 		}
 
 		// release maps
@@ -539,12 +583,16 @@ struct baseTree_t {
 			freeMap(compBeenWhatL);
 		if (compBeenWhatR)
 			freeMap(compBeenWhatR);
+		if (compareCache)
+			ctx.myFree("baseTree_t::compareCache", compareCache);
+		if (refCount)
+			ctx.myFree("baseTree_t::refCount", refCount);
 
 		// release pools
 		while (numPoolMap > 0)
-			ctx.myFree("baseTree_t::nodeMap", pPoolMap[--numPoolMap]);
+			ctx.myFreeLazy("baseTree_t::nodeMap", pPoolMap[--numPoolMap], maxNodes, sizeof(**pPoolMap));
 		while (numPoolVersion > 0)
-			ctx.myFree("baseTree_t::versionMap", pPoolVersion[--numPoolVersion]);
+			ctx.myFreeLazy("baseTree_t::versionMap", pPoolVersion[--numPoolVersion], maxNodes, sizeof(**pPoolVersion));
 
 		// release resources
 		if (hndl >= 0) {
@@ -558,9 +606,10 @@ struct baseTree_t {
 			ret = ::close(hndl);
 			if (ret)
 				ctx.fatal("close() returned: %m\n");
-		} else if (rawData) {
+		} else if (allocFlags & ALLOCMASK_RAWDATA) {
 			/*
 			 * Database was read into `malloc()` buffer
+			 * NOTE: images attached with `loadImage()` are owned by the caller
 			 */
 			ctx.myFree("baseTreeFile_t::rawData", rawData);
 		}
@@ -581,8 +630,10 @@ struct baseTree_t {
 		compBeenWhatR    = NULL;
 		compVersionL     = NULL;
 		compVersionR     = NULL;
+		compareCache     = NULL;
 		rewriteMap       = NULL;
 		rewriteVersion   = NULL;
+		refCount         = NULL;
 	}
 
 	/*
@@ -593,7 +644,39 @@ struct baseTree_t {
 		this->ncount = this->nstart;
 		// invalidate lookup cache
 		++this->nodeIndexVersionNr;
+		// invalidate compare cache, node ids get reused
+		invalidateCompareCache();
+		// release references
+		if (this->refCount) {
+			for (uint32_t iEntry = 0; iEntry < this->nstart; iEntry++)
+				this->refCount[iEntry] = 0;
+		}
+	}
 
+	/*
+	 * @date 2022-03-13 14:06:28
+	 *
+	 * Enable live reference counting.
+	 * `newNode()` adds the references of every created node and `rewind()` releases them,
+	 *   making `refCount[]` always reflect the nodes in `N[nstart..ncount)`, reachable or not.
+	 * This replaces a full tree scan when all that is needed is which keys are in use.
+	 */
+	void enableRefCount(void) {
+		if (!this->refCount)
+			this->refCount = (uint32_t *) ctx.myAlloc("baseTree_t::refCount", maxNodes, sizeof *refCount);
+
+		for (uint32_t iNode = 0; iNode < this->ncount; iNode++)
+			this->refCount[iNode] = 0;
+
+		for (uint32_t iNode = this->nstart; iNode < this->ncount; iNode++) {
+			const baseNode_t *pNode = this->N + iNode;
+			const uint32_t   Tu     = pNode->T & ~IBIT;
+
+			this->refCount[pNode->Q]++;
+			if (Tu != pNode->F)
+				this->refCount[Tu]++;
+			this->refCount[pNode->F]++;
+		}
 	}
 
 	/*
@@ -606,6 +689,10 @@ struct baseTree_t {
 	 * Allocate a map that can hold node id's
 	 * Returned map is uninitialised
 	 *
+	 * @date 2022-03-13 22:53:40
+	 *
+	 * Maps are lazy, physical memory is only claimed for the node id's that get touched.
+	 *
 	 * @return {uint32_t*} - Uninitialised map for node id's
 	 */
 	uint32_t *allocMap(void) {
@@ -616,7 +703,7 @@ struct baseTree_t {
 			pMap = pPoolMap[--numPoolMap];
 		} else {
 			// allocate new map
-			pMap = (uint32_t *) ctx.myAlloc("baseTree_t::versionMap", maxNodes, sizeof *pMap);
+			pMap = (uint32_t *) ctx.myAllocLazy("baseTree_t::nodeMap", maxNodes, sizeof *pMap);
 		}
 
 		return pMap;
@@ -644,7 +731,7 @@ struct baseTree_t {
 	 * Allocate a map that can hold versioned memory id's
 	 * Returned map is uninitialised and should ONLY contain previous (lower) version numbers
 
-	 * NOTE: caller needs clear map on `mapVersionNr` wraparound
+	 * NOTE: caller needs clear map on `mapVersionNr` wraparound, preferably with `context_t::myClearLazy()`
 	 *
 	 * @return {uint32_t*} - Uninitialised map for versioned memory id's
 	 */
@@ -656,7 +743,7 @@ struct baseTree_t {
 			pVersion = pPoolVersion[--numPoolVersion];
 		} else {
 			// allocate new map
-			pVersion = (uint32_t *) ctx.myAlloc("baseTree_t::versionMap", maxNodes, sizeof *pVersion);
+			pVersion = (uint32_t *) ctx.myAllocLazy("baseTree_t::versionMap", maxNodes, sizeof *pVersion);
 		}
 
 		return pVersion;
@@ -699,7 +786,7 @@ struct baseTree_t {
 	 *       0 L = R
 	 *      +1 L > R
 	 */
-	int compare(uint32_t lhs, baseTree_t *treeR, uint32_t rhs, unsigned topLevelCascade = CASCADE_NONE) {
+	int compareWalk(uint32_t lhs, baseTree_t *treeR, uint32_t rhs, unsigned topLevelCascade) {
 
 		/*
 		 * This code is a resource hit, but worth the effort.
@@ -717,15 +804,13 @@ struct baseTree_t {
 		uint32_t thisVersionR = ++treeR->compVersionNr;
 		// version overflow, clear
 		if (thisVersionL == 0) {
-			::memset(this->compVersionL, 0, this->maxNodes * sizeof *compVersionL);
+			context_t::myClearLazy(this->compVersionL, this->maxNodes * sizeof *compVersionL);
 			thisVersionL = ++this->compVersionNr;
 		}
 		if (thisVersionR == 0) {
-			::memset(treeR->compVersionR, 0, treeR->maxNodes * sizeof *compVersionR);
+			context_t::myClearLazy(treeR->compVersionR, treeR->maxNodes * sizeof *compVersionR);
 			thisVersionR = ++treeR->compVersionNr;
 		}
-		this->numCompare++; // only for L
-
 		assert(!(lhs & IBIT));
 		assert(!(rhs & IBIT));
 
@@ -991,6 +1076,55 @@ struct baseTree_t {
 		return 0;
 	}
 
+	/*
+	 * @date 2022-03-14 00:52:30
+	 *
+	 * Invalidate all cached compare results
+	 */
+	void invalidateCompareCache(void) {
+		if (++compareCacheVersionNr >= (1U << 29)) {
+			// version overflow, clear
+			if (compareCache)
+				::memset(compareCache, 0, COMPARECACHESIZE * sizeof(*compareCache));
+			compareCacheVersionNr = 1;
+		}
+	}
+
+	/*
+	 * @date 2022-03-14 00:53:04
+	 *
+	 * Compare two-subtrees, see `compareWalk()`.
+	 * Results are cached for node pairs of the same tree.
+	 * Nodes beyond `ncount` are excluded, `addNormaliseNode()` simulates those and their contents change.
+	 */
+	int compare(uint32_t lhs, baseTree_t *treeR, uint32_t rhs, unsigned topLevelCascade = CASCADE_NONE) {
+		this->numCompare++; // only for L
+
+		if (this->compareCache == NULL || this != treeR || lhs == rhs || lhs < this->nstart || rhs < this->nstart || lhs >= this->ncount || rhs >= this->ncount)
+			return compareWalk(lhs, treeR, rhs, topLevelCascade);
+
+		uint32_t version = (compareCacheVersionNr << 3) | topLevelCascade;
+
+		uint32_t crc32 = 0;
+		__asm__ __volatile__ ("crc32l %1, %0" : "+r"(crc32) : "rm"(lhs));
+		__asm__ __volatile__ ("crc32l %1, %0" : "+r"(crc32) : "rm"(rhs));
+		__asm__ __volatile__ ("crc32l %1, %0" : "+r"(crc32) : "rm"(topLevelCascade));
+
+		baseCompareEntry_t *pEntry = compareCache + (crc32 & (COMPARECACHESIZE - 1));
+
+		if (pEntry->version == version && pEntry->lhs == lhs && pEntry->rhs == rhs)
+			return pEntry->result;
+
+		int result = compareWalk(lhs, treeR, rhs, topLevelCascade);
+
+		pEntry->lhs     = lhs;
+		pEntry->rhs     = rhs;
+		pEntry->version = version;
+		pEntry->result  = result;
+
+		return result;
+	}
+
 	/*
 	 * @date 2021-05-12 18:18:58
 	 *
@@ -1095,6 +1229,14 @@ struct baseTree_t {
 		this->N[id].T = T;
 		this->N[id].F = F;
 
+		if (this->refCount) {
+			this->refCount[id] = 0;
+			this->refCount[Q]++;
+			if ((T & ~IBIT) != F)
+				this->refCount[T & ~IBIT]++;
+			this->refCount[F]++;
+		}
+
 		return id;
 	}
 
@@ -2905,7 +3047,7 @@ struct baseTree_t {
 			uint32_t thisVersion = ++iVersionRewrite;
 			if (thisVersion == 0) {
 				// version overflow, clear
-				memset(rewriteVersion, 0, this->maxNodes * sizeof(*rewriteVersion));
+				context_t::myClearLazy(rewriteVersion, this->maxNodes * sizeof(*rewriteVersion));
 
 				thisVersion = ++iVersionRewrite;
 			}
@@ -3211,7 +3353,8 @@ struct baseTree_t {
 	 *
 	 * NOTE: `std::string` usage exception because this is NOT speed critical code AND strings can become gigantically large
 	 */
-	static void encodePrefix(std::string &name, unsigned value) {
+	template<class T>
+	static void encodePrefix(T &name, unsigned value) {
 
 		// NOTE: 0x7fffffff = `GYTISXx`
 
@@ -3233,6 +3376,25 @@ struct baseTree_t {
 		}
 	}
 
+	/*
+	 * @date 2022-03-13 23:57:40
+	 *
+	 * Inverse of `encodePrefix()`.
+	 * Consume the upper-case prefix starting at `pattern` and leave `pattern` at the first character following it.
+	 */
+	static inline uint32_t decodePrefix(const char *&pattern) {
+		uint32_t v = 0;
+		unsigned c;
+
+		// unsigned compare avoids the locale lookups of `isupper()`
+		while ((c = (unsigned char) *pattern - 'A') < 26) {
+			v = v * 26 + c;
+			pattern++;
+		}
+
+		return v;
+	}
+
 	/*
 	 * @date 2021-05-22 19:18:33
 	 *
@@ -3246,9 +3408,34 @@ struct baseTree_t {
 	 * if `allRoots` is true, then ignore `id` and output all roots. 
 	 */
 	std::string saveString(uint32_t id, std::string *pTransform = NULL, bool allRoots = false) {
-
 		std::string name;
 
+		emitString(name, id, pTransform, allRoots);
+
+		return name;
+	}
+
+	/*
+	 * @date 2022-03-14 00:11:05
+	 *
+	 * Export as `saveString()`, but stream directly to `outf`.
+	 * Memory usage is bounded by the buffer and does not depend on the size of the notation.
+	 */
+	void saveString(FILE *outf, uint32_t id, std::string *pTransform = NULL, bool allRoots = false) {
+		streamWriter_t writer(ctx, outf);
+
+		emitString(writer, id, pTransform, allRoots);
+		writer.flush();
+	}
+
+	/*
+	 * @date 2022-03-14 00:11:31
+	 *
+	 * Core of `saveString()`, `name` is anything with a `+= char` operator.
+	 */
+	template<class T>
+	void emitString(T &name, uint32_t id, std::string *pTransform, bool allRoots) {
+
 		uint32_t nextPlaceholder = this->kstart;
 		uint32_t nextNode        = this->nstart;
 		uint32_t *pStack         = allocMap();
@@ -3259,7 +3446,7 @@ struct baseTree_t {
 
 		// clear version map when wraparound
 		if (thisVersion == 0) {
-			::memset(pVersion, 0, maxNodes * sizeof *pVersion);
+			context_t::myClearLazy(pVersion, maxNodes * sizeof *pVersion);
 			thisVersion = ++mapVersionNr;
 		}
 
@@ -3411,8 +3598,6 @@ struct baseTree_t {
 		freeMap(pMap);
 		freeMap(pStack);
 		freeVersion(pVersion);
-
-		return name;
 	}
 
 	/*
@@ -3610,14 +3795,38 @@ struct baseTree_t {
 		if (pSkin && *pSkin)
 			transformList = decodeTransform(ctx, kstart, nstart, pSkin);
 
+		/*
+		 * @date 2022-03-13 23:58:12
+		 *
+		 * Scratch is sized to the string instead of `maxNodes`.
+		 * Every token pushes at most one stack entry and creates at most one node.
+		 */
+		size_t   nameLen   = strlen(pName);
+		uint32_t *pScratch = (uint32_t *) ctx.myAlloc("baseTree_t::pScratch", 2 * (nameLen + 1), sizeof *pScratch);
+
+		uint32_t ret = parseStringSafe(pName, transformList, pRoots ? pRoots : pScratch, pScratch + nameLen + 1, pRoots != NULL);
+
+		ctx.myFree("baseTree_t::pScratch", pScratch);
+		if (transformList)
+			ctx.myFree("groupTree_t::transformList", transformList);
+
+		return ret;
+	}
+
+	/*
+	 * @date 2022-03-13 23:59:05
+	 *
+	 * Parser behind `loadStringSafe()`.
+	 * `pStack` holds at least one entry per token, `pMap` is indexed by node relative to `nstart`.
+	 */
+	uint32_t parseStringSafe(const char *pName, const uint32_t *transformList, uint32_t *pStack, uint32_t *pMap, bool multiRoot) {
+
 		/*
 		 * init
 		 */
 
 		uint32_t numStack = 0;
 		uint32_t nextNode = this->nstart;
-		uint32_t *pStack  = pRoots ? pRoots : allocMap();
-		uint32_t *pMap    = allocMap();
 		uint32_t nid;
 
 		/*
@@ -3646,7 +3855,7 @@ struct baseTree_t {
 				if (numStack >= this->maxNodes)
 					ctx.fatal("[stack overflow]\n");
 
-				pStack[numStack++] = pMap[v];
+				pStack[numStack++] = pMap[v - this->nstart];
 
 				break;
 			}
@@ -3692,9 +3901,7 @@ struct baseTree_t {
 				/*
 				 * Prefix
 				 */
-				uint32_t v = 0;
-				while (isupper(*pattern))
-					v = v * 26 + *pattern++ - 'A';
+				uint32_t v = decodePrefix(pattern);
 
 				if (isdigit(*pattern)) {
 					/*
@@ -3707,7 +3914,7 @@ struct baseTree_t {
 					if (numStack >= this->maxNodes)
 						ctx.fatal("[stack overflow]\n");
 
-					pStack[numStack++] = pMap[v];
+					pStack[numStack++] = pMap[v - this->nstart];
 				} else if (islower(*pattern)) {
 					/*
 					 * prefixed endpoint
@@ -3739,7 +3946,7 @@ struct baseTree_t {
 
 				nid = addNormaliseNode(L, IBIT, R);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '>': {
@@ -3752,7 +3959,7 @@ struct baseTree_t {
 
 				nid = addNormaliseNode(L, R ^ IBIT, 0);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '^': {
@@ -3765,7 +3972,7 @@ struct baseTree_t {
 
 				nid = addNormaliseNode(L, R ^ IBIT, R);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '!': {
@@ -3779,7 +3986,7 @@ struct baseTree_t {
 
 				nid = addNormaliseNode(Q, T ^ IBIT, F);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '&': {
@@ -3792,7 +3999,7 @@ struct baseTree_t {
 
 				nid = addNormaliseNode(L, R, 0);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '?': {
@@ -3806,7 +4013,7 @@ struct baseTree_t {
 
 				nid = addNormaliseNode(Q, T, F);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '~': {
@@ -3836,7 +4043,7 @@ struct baseTree_t {
 
 		uint32_t ret;
 
-		if (pRoots) {
+		if (multiRoot) {
 			// loaded multi-rooted tree
 			ret = numStack;
 		} else {
@@ -3847,13 +4054,6 @@ struct baseTree_t {
 			ret = pStack[numStack - 1];
 		}
 
-
-		if (pRoots == NULL)
-			freeMap(pStack);
-		freeMap(pMap);
-		if (transformList)
-			ctx.myFree("groupTree_t::transformList", transformList);
-
 		return ret;
 	}
 
@@ -3872,14 +4072,33 @@ struct baseTree_t {
 		if (pSkin && *pSkin)
 			transformList = decodeTransform(ctx, kstart, nstart, pSkin);
 
+		// scratch for stack and node map, sized to the string
+		size_t   nameLen   = strlen(pName);
+		uint32_t *pScratch = (uint32_t *) ctx.myAlloc("baseTree_t::pScratch", 2 * (nameLen + 1), sizeof *pScratch);
+
+		uint32_t ret = parseStringFast(pName, transformList, pScratch, pScratch + nameLen + 1);
+
+		ctx.myFree("baseTree_t::pScratch", pScratch);
+		if (transformList)
+			ctx.myFree("groupTree_t::transformList", transformList);
+
+		return ret;
+	}
+
+	/*
+	 * @date 2022-03-14 00:00:06
+	 *
+	 * Parser behind `loadStringFast()`.
+	 * `pStack` holds at least one entry per token, `pMap` is indexed by node relative to `nstart`.
+	 */
+	uint32_t parseStringFast(const char *pName, const uint32_t *transformList, uint32_t *pStack, uint32_t *pMap) {
+
 		/*
 		 * init
 		 */
 
 		uint32_t numStack = 0;
 		uint32_t nextNode = this->nstart;
-		uint32_t *pStack  = allocMap();
-		uint32_t *pMap    = allocMap();
 		uint32_t nid;
 
 		/*
@@ -3908,7 +4127,7 @@ struct baseTree_t {
 				if (numStack >= this->ncount)
 					ctx.fatal("[stack overflow]\n");
 
-				pStack[numStack++] = pMap[v];
+				pStack[numStack++] = pMap[v - this->nstart];
 
 				break;
 			}
@@ -3954,9 +4173,7 @@ struct baseTree_t {
 				/*
 				 * Prefix
 				 */
-				uint32_t v = 0;
-				while (isupper(*pattern))
-					v = v * 26 + *pattern++ - 'A';
+				uint32_t v = decodePrefix(pattern);
 
 				if (isdigit(*pattern)) {
 					/*
@@ -3969,7 +4186,7 @@ struct baseTree_t {
 					if (numStack >= this->ncount)
 						ctx.fatal("[stack overflow]\n");
 
-					pStack[numStack++] = pMap[v];
+					pStack[numStack++] = pMap[v - this->nstart];
 				} else if (islower(*pattern)) {
 					/*
 					 * prefixed endpoint
@@ -4001,7 +4218,7 @@ struct baseTree_t {
 
 				nid = addNode(L, IBIT, R);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '>': {
@@ -4014,7 +4231,7 @@ struct baseTree_t {
 
 				nid = addNode(L, R ^ IBIT, 0);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '^': {
@@ -4027,7 +4244,7 @@ struct baseTree_t {
 
 				nid = addNode(L, R ^ IBIT, R);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '!': {
@@ -4041,7 +4258,7 @@ struct baseTree_t {
 
 				nid = addNode(Q, T ^ IBIT, F);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '&': {
@@ -4054,7 +4271,7 @@ struct baseTree_t {
 
 				nid = addNode(L, R, 0);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '?': {
@@ -4068,7 +4285,7 @@ struct baseTree_t {
 
 				nid = addNode(Q, T, F);
 
-				pStack[numStack++] = pMap[nextNode++] = nid;
+				pStack[numStack++] = pMap[nextNode++ - this->nstart] = nid;
 				break;
 			}
 			case '~': {
@@ -4100,11 +4317,6 @@ struct baseTree_t {
 
 		uint32_t ret = pStack[numStack - 1];
 
-		freeMap(pStack);
-		freeMap(pMap);
-		if (transformList)
-			ctx.myFree("groupTree_t::transformList", transformList);
-
 		return ret;
 	}
 
@@ -4117,7 +4329,7 @@ struct baseTree_t {
 		uint32_t thisVersion = ++this->mapVersionNr;
 
 		if (thisVersion == 0) {
-			::memset(pSelect, 0, this->maxNodes * sizeof *pSelect);
+			context_t::myClearLazy(pSelect, this->maxNodes * sizeof *pSelect);
 			thisVersion = ++this->mapVersionNr;
 		}
 
@@ -4183,7 +4395,7 @@ struct baseTree_t {
 
 		// clear version map when wraparound
 		if (thisVersion == 0) {
-			::memset(pSelect, 0, RHS->maxNodes * sizeof *pSelect);
+			context_t::myClearLazy(pSelect, RHS->maxNodes * sizeof *pSelect);
 			thisVersion = ++RHS->mapVersionNr;
 		}
 
@@ -4249,7 +4461,7 @@ struct baseTree_t {
 
 		// clear version map when wraparound
 		if (thisVersion == 0) {
-			::memset(pSelect, 0, RHS->maxNodes * sizeof *pSelect);
+			context_t::myClearLazy(pSelect, RHS->maxNodes * sizeof *pSelect);
 			thisVersion = ++RHS->mapVersionNr;
 		}
 
@@ -4429,13 +4641,48 @@ struct baseTree_t {
 			 */
 			close(hndl);
 			hndl = -1;
+
+			allocFlags |= ALLOCMASK_RAWDATA;
 		}
 
+		attachImage(rawData, (uint64_t) stbuf.st_size);
+
+		return 0;
+	}
+
+	/*
+	 * @date 2022-03-13 23:15:52
+	 *
+	 * Load tree from an image in memory, typically a slice of a `sliceFile_t` container.
+	 * Image is used in-place and must outlive the tree.
+	 *
+	 * return 0 for ok.
+	 */
+	unsigned loadImage(const uint8_t *pImage, uint64_t imageLength) {
+
+		if (!entryNames.empty() || !rootNames.empty() || allocFlags || hndl >= 0)
+			ctx.fatal("baseTree_t::loadImage() on non-initial tree\n");
+
+		attachImage((uint8_t *) pImage, imageLength);
+
+		return 0;
+	}
+
+	/*
+	 * @date 2022-03-13 23:16:07
+	 *
+	 * Setup tree sections from file image.
+	 * Shared by `loadFile()` and `loadImage()`.
+	 */
+	void attachImage(uint8_t *pImage, uint64_t imageLength) {
+
+		rawData = pImage;
+
 		fileHeader = (baseTreeHeader_t *) rawData;
 		if (fileHeader->magic != BASETREE_MAGIC)
 			ctx.fatal("baseTree version mismatch. Expected %08x, Encountered %08x\n", BASETREE_MAGIC, fileHeader->magic);
-		if (fileHeader->offEnd != (uint64_t) stbuf.st_size)
-			ctx.fatal("baseTree size mismatch. Expected %lu, Encountered %lu\n", fileHeader->offEnd, (uint64_t) stbuf.st_size);
+		if (fileHeader->offEnd != imageLength)
+			ctx.fatal("baseTree size mismatch. Expected %lu, Encountered %lu\n", fileHeader->offEnd, imageLength);
 
 		flags      = fileHeader->magic_flags;
 		unused1    = fileHeader->unused1;
@@ -4490,8 +4737,6 @@ struct baseTree_t {
 			// expect terminator
 			assert(*pData == 0);
 		}
-
-		return 0;
 	}
 
 	/*
@@ -4503,6 +4748,57 @@ struct baseTree_t {
 	 */
 	void saveFile(const char *fileName, bool showProgress = true) {
 
+//		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+//			fprintf(stderr, "[%s] Writing %s\n", ctx.timeAsString(), fileName);
+
+		/*
+		 * Open output file
+		 */
+
+//		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
+//			fprintf(stderr, "\r\e[Kopening");
+
+		FILE *outf = fopen(fileName, "w");
+		if (!outf)
+			ctx.fatal("Failed to open %s: %m\n", fileName);
+
+		saveImage(outf, fileName);
+
+		// test for errors, most likely disk-full
+		if (feof(outf) || ferror(outf)) {
+			unlink(fileName);
+			ctx.fatal("[ferror(%s,\"w\") returned: %m]\n", fileName);
+		}
+
+//		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
+//			fprintf(stderr, "\r\e[Kclosing");
+
+		// close
+		if (fclose(outf)) {
+			unlink(fileName);
+			ctx.fatal("[fclose(%s,\"w\") returned: %m]\n", fileName);
+		}
+
+		if (showProgress && ctx.opt_verbose >= ctx.VERBOSE_TICK)
+			fprintf(stderr, "\r\e[K"); // erase showProgress
+
+//		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+//			fprintf(stderr, "[%s] Written %s, %u nodes, %lu bytes\n", ctx.timeAsString(), fileName, ncount - nstart, fileHeader->offEnd);
+	}
+
+	/*
+	 * @date 2022-03-13 23:17:20
+	 *
+	 * Write tree image at the current position of `outf`.
+	 * Section offsets are relative to the start of the image so it can be embedded in a `sliceFile_t` container.
+	 * Caller is responsible for opening/closing and error detection.
+	 *
+	 * @param {FILE*} outf - Output stream, positioned at start of image
+	 * @param {string} fileName - Name of output, for error messages
+	 * @return {number} - Length of image
+	 */
+	uint64_t saveImage(FILE *outf, const char *fileName) {
+
 		assert(numRoots > 0);
 
 		/*
@@ -4520,19 +4816,10 @@ struct baseTree_t {
 		// crc for nodes/roots
 		uint32_t       crc32      = 0;
 
-//		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
-//			fprintf(stderr, "[%s] Writing %s\n", ctx.timeAsString(), fileName);
-
-		/*
-		 * Open output file
-		 */
-
-//		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
-//			fprintf(stderr, "\r\e[Kopening");
-
-		FILE *outf = fopen(fileName, "w");
-		if (!outf)
-			ctx.fatal("Failed to open %s: %m\n", fileName);
+		// start of image
+		off_t fbase = ftello(outf);
+		if (fbase == -1)
+			ctx.fatal("[ftello(%s) returned: %m]\n", fileName);
 
 		/*
 		** Write empty header (overwritten later)
@@ -4651,7 +4938,7 @@ struct baseTree_t {
 
 			// clear version map when wraparound
 			if (thisVersion == 0) {
-				::memset(pVersion, 0, maxNodes * sizeof *pVersion);
+				context_t::myClearLazy(pVersion, maxNodes * sizeof *pVersion);
 				thisVersion = ++mapVersionNr;
 			}
 
@@ -4817,37 +5104,18 @@ struct baseTree_t {
 		header.posHistory  = posHistory;
 		header.offEnd      = fpos;
 
-		// rewrite header
-		fseek(outf, 0, SEEK_SET);
+		// rewrite header and position after image
+		fseeko(outf, fbase, SEEK_SET);
 		fwrite(&header, sizeof header, 1, outf);
-
-		// test for errors, most likely disk-full
-		if (feof(outf) || ferror(outf)) {
-			unlink(fileName);
-			ctx.fatal("[ferror(%s,\"w\") returned: %m]\n", fileName);
-		}
-
-//		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
-//			fprintf(stderr, "\r\e[Kclosing");
-
-		// close
-		if (fclose(outf)) {
-			unlink(fileName);
-			ctx.fatal("[fclose(%s,\"w\") returned: %m]\n", fileName);
-		}
-
-		if (showProgress && ctx.opt_verbose >= ctx.VERBOSE_TICK)
-			fprintf(stderr, "\r\e[K"); // erase showProgress
+		fseeko(outf, fbase + (off_t) fpos, SEEK_SET);
 
 		// release maps
 		freeMap(pMap);
 
-
-//		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
-//			fprintf(stderr, "[%s] Written %s, %u nodes, %lu bytes\n", ctx.timeAsString(), fileName, ncount - nstart, header.offEnd);
-
 		// make header available
 		fileHeader = &header;
+
+		return fpos;
 	}
 
 	/*
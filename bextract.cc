@@ -39,6 +39,7 @@
 
 #include "context.h"
 #include "basetree.h"
+#include "slicefile.h"
 
 /*
  * Resource context.
@@ -79,6 +80,8 @@ struct bextractContext_t {
 	unsigned opt_force;
 	/// @var {number} --maxnode, Maximum number of nodes for `baseTree_t`.
 	unsigned opt_maxNode;
+	/// @var {number} --slice, input is a `sliceFile_t` container, select slice with this id
+	int      opt_slice;
 
 	/// @var {baseTree_t*} input tree
 	baseTree_t *pInputTree;
@@ -87,6 +90,7 @@ struct bextractContext_t {
 		opt_flags   = 0;
 		opt_force   = 0;
 		opt_maxNode = DEFAULT_MAXNODE;
+		opt_slice   = -1;
 	}
 
 	/**
@@ -99,9 +103,32 @@ struct bextractContext_t {
 		/*
 		 * Open input tree
 		 */
-		baseTree_t *pOldTree = new baseTree_t(ctx);
+		baseTree_t  *pOldTree = new baseTree_t(ctx);
+		sliceFile_t slices(ctx);
+		unsigned    ret;
+
+		if (opt_slice >= 0) {
+			// @date 2022-03-13 23:30:04 attach slice from container in-place
+			slices.open(inputFilename);
+
+			uint32_t iSlice = 0;
+			while (iSlice < slices.numSlices && slices.directory[iSlice].id != (uint32_t) opt_slice)
+				iSlice++;
+
+			if (iSlice >= slices.numSlices) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("slice not found"));
+				json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
+				json_object_set_new_nocheck(jError, "slice", json_integer(opt_slice));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+
+			ret = slices.loadSlice(iSlice, *pOldTree);
+		} else {
+			ret = pOldTree->loadFile(inputFilename);
+		}
 
-		if (pOldTree->loadFile(inputFilename)) {
+		if (ret) {
 			json_t *jError = json_object();
 			json_object_set_new_nocheck(jError, "error", json_string_nocheck("failed to load"));
 			json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
@@ -261,6 +288,7 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --force\n");
 		fprintf(stderr, "\t   --maxnode=<number> [default=%d]\n", app.opt_maxNode);
 		fprintf(stderr, "\t-q --quiet\n");
+		fprintf(stderr, "\t   --slice=<id>  # NOTE: 'input' is a slice container\n");
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
 		fprintf(stderr, "\t-v --verbose\n");
 		fprintf(stderr, "\t   --[no-]paranoid [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PARANOID ? "enabled" : "disabled");
@@ -288,7 +316,7 @@ int main(int argc, char *argv[]) {
 
 	for (;;) {
 		enum {
-			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE,
+			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE, LO_SLICE,
 			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE, LO_SHRINK, LO_NOSHRINK, LO_PIVOT3, LO_NOPIVOT3,
 			LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
@@ -300,6 +328,7 @@ int main(int argc, char *argv[]) {
 			{"help",        0, 0, LO_HELP},
 			{"maxnode",     1, 0, LO_MAXNODE},
 			{"quiet",       2, 0, LO_QUIET},
+			{"slice",       1, 0, LO_SLICE},
 			{"timer",       1, 0, LO_TIMER},
 			{"verbose",     2, 0, LO_VERBOSE},
 			//
@@ -356,6 +385,9 @@ int main(int argc, char *argv[]) {
 		case LO_QUIET:
 			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose - 1;
 			break;
+		case LO_SLICE:
+			app.opt_slice = (int) strtoul(optarg, NULL, 10);
+			break;
 		case LO_TIMER:
 			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
 			break;
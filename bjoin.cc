@@ -31,10 +31,12 @@
 #include <jansson.h>
 #include <stdlib.h>
 #include <unistd.h>
-#include <map>
+#include <utility>
+#include <vector>
 
 #include "context.h"
 #include "basetree.h"
+#include "slicefile.h"
 
 /*
  * Resource context.
@@ -77,6 +79,90 @@ struct bjoinContext_t {
 	/// @var {number} --maxnode, Maximum number of nodes for `baseTree_t`.
 	unsigned opt_maxNode;
 
+	/*
+	 * @date 2022-03-13 23:27:36
+	 *
+	 * An input is either a tree file or a slice of a `sliceFile_t` container
+	 */
+	struct input_t {
+		std::string           name;     // filename or `<container>#<id>`, for messages
+		sliceFile_t           *pSlices; // container, NULL for tree files
+		uint32_t              iSlice;   // slice number within container
+		uint32_t              kstart;   // header of input, collected during first pass
+		uint32_t              numRoots; //
+		uint32_t              flags;    //
+		std::vector<uint32_t> entryIds; // name id of entrypoints
+		std::vector<uint32_t> rootIds;  // name id of roots
+	};
+
+	enum {
+		NOTFOUND = 0xffffffff, // name not found
+	};
+
+	/*
+	 * @date 2022-03-13 23:50:02
+	 *
+	 * Hashed name table.
+	 * Names get consecutive ids in order of insertion.
+	 * Open addressing with linear probing, index holds `id+1` with 0 for empty.
+	 */
+	struct nameTable_t {
+		std::vector<std::string> names;  // names by id
+		std::vector<uint32_t>    index;  // hash index, size is a power of 2
+		uint32_t                 mask;   // index size - 1
+
+		nameTable_t() : names(), index(1024), mask(1024 - 1) {
+		}
+
+		uint32_t size(void) const {
+			return names.size();
+		}
+
+		static uint32_t hash(const std::string &name) {
+			uint32_t   crc32 = 0;
+			const char *p    = name.c_str();
+
+			for (size_t len = name.size(); len; --len, ++p)
+				__asm__ __volatile__ ("crc32b %1, %0" : "+r"(crc32) : "rm"(*p));
+			return crc32;
+		}
+
+		/*
+		 * Locate name, add when missing
+		 */
+		uint32_t insert(const std::string &name) {
+			uint32_t ix = hash(name) & mask;
+
+			for (; index[ix]; ix = (ix + 1) & mask) {
+				if (names[index[ix] - 1] == name)
+					return index[ix] - 1;
+			}
+
+			uint32_t id = names.size();
+			names.push_back(name);
+			index[ix] = id + 1;
+
+			// keep load factor below 1/2
+			if (names.size() * 2 > index.size()) {
+				index.assign(index.size() * 2, 0);
+				mask = index.size() - 1;
+
+				for (uint32_t i = 0; i < names.size(); i++) {
+					for (ix = hash(names[i]) & mask; index[ix]; ix = (ix + 1) & mask) {
+					}
+					index[ix] = i + 1;
+				}
+			}
+
+			return id;
+		}
+	};
+
+	/// @var {input_t[]} - inputs with containers expanded
+	std::vector<input_t>     inputs;
+	/// @var {sliceFile_t[]} - open containers
+	std::vector<sliceFile_t *> containers;
+
 	bjoinContext_t() {
 		opt_extend  = 0;
 		opt_flags   = 0;
@@ -84,65 +170,107 @@ struct bjoinContext_t {
 		opt_maxNode = DEFAULT_MAXNODE;
 	}
 
-	/**
-	 * @date 2021-05-20 23:15:36
+	~bjoinContext_t() {
+		for (unsigned i = 0; i < containers.size(); i++)
+			delete containers[i];
+	}
+
+	/*
+	 * @date 2022-03-13 23:27:51
 	 *
-	 * Main entrypoint
+	 * Expand input filenames, containers contribute all their slices in order
 	 */
-	int main(const char *outputFilename, unsigned numInputs, char **inputFilenames) {
+	void collectInputs(unsigned numInputs, char **inputFilenames) {
+		for (unsigned iFile = 0; iFile < numInputs; iFile++) {
+			const char *fileName = inputFilenames[iFile];
+			input_t    input;
+
+			if (!sliceFile_t::isSliceFile(fileName)) {
+				input.name    = fileName;
+				input.pSlices = NULL;
+				input.iSlice  = 0;
+				inputs.push_back(input);
+				continue;
+			}
 
-		const char *inputFilename = inputFilenames[0];
+			sliceFile_t *pSlices = new sliceFile_t(ctx);
+			pSlices->open(fileName);
+			containers.push_back(pSlices);
 
-		/*
-		 * Open the first file to extract template data
-		 */
-		baseTree_t *pOldTree = new baseTree_t(ctx);
+			for (uint32_t iSlice = 0; iSlice < pSlices->numSlices; iSlice++) {
+				char sbuf[32];
+				sprintf(sbuf, "#%u", pSlices->directory[iSlice].id);
 
-		if (pOldTree->loadFile(inputFilename)) {
+				input.name    = std::string(fileName) + sbuf;
+				input.pSlices = pSlices;
+				input.iSlice  = iSlice;
+				inputs.push_back(input);
+			}
+		}
+	}
+
+	/*
+	 * @date 2022-03-13 23:28:12
+	 *
+	 * Load an input into a new tree
+	 */
+	baseTree_t *loadInput(const input_t &input) {
+		baseTree_t *pTree = new baseTree_t(ctx);
+		unsigned   ret;
+
+		if (input.pSlices)
+			ret = input.pSlices->loadSlice(input.iSlice, *pTree);
+		else
+			ret = pTree->loadFile(input.name.c_str());
+
+		if (ret) {
 			json_t *jError = json_object();
 			json_object_set_new_nocheck(jError, "error", json_string_nocheck("failed to load"));
-			json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
+			json_object_set_new_nocheck(jError, "filename", json_string(input.name.c_str()));
 			ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 		}
 
-		if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE) {
-			json_t *jResult = json_object();
-			json_object_set_new_nocheck(jResult, "filename", json_string_nocheck(inputFilename));
-			pOldTree->headerInfo(jResult);
-			pOldTree->extraInfo(jResult);
-			fprintf(stderr, "%s\n", json_dumps(jResult, JSON_PRESERVE_ORDER | JSON_COMPACT));
-			json_delete(jResult);
-		}
+		return pTree;
+	}
+
+	/**
+	 * @date 2021-05-20 23:15:36
+	 *
+	 * Main entrypoint
+	 */
+	int main(const char *outputFilename, unsigned numInputs, char **inputFilenames) {
+
+		collectInputs(numInputs, inputFilenames);
+
+		numInputs = inputs.size();
+		if (numInputs == 0)
+			ctx.fatal("no inputs\n");
+
+		const char *inputFilename;
+		baseTree_t *pOldTree;
 
 		/*
-		 * Collect names
+		 * @date 2022-03-13 23:51:18
+		 *
+		 * Collect names.
+		 * Inputs are released after scanning, only the name ids of their entrypoints and roots are kept.
+		 * This makes the second pass free of string operations.
 		 */
-		std::vector<std::string>        entryNames;              // The names of the entries
-		std::vector<std::string>        rootNames;               // The names of the roots
-		std::vector<std::string>        rootFiles;               // Files declaring roots
-		std::map<std::string, unsigned> entryLookup;             // Name lookup	
-		std::map<std::string, unsigned> rootLookup;              // Name lookup	
-		std::vector<uint32_t>           entryMap;                // How current tree entrypoints map onto entryNames
-		std::vector<uint32_t>           rootMap;                 // How current tree roots map onto rootNames
-		unsigned                        newNumRoots = 0;         // number of roots for last input
-		uint32_t                        newFlags    = ctx.flags; // creation flags
-		uint32_t                        newKstart   = 0;         // kstart of last input
+		nameTable_t           names;                   // All names, in order of first appearance
+		std::vector<uint32_t> nameRoot;                // Index into `rootNames[]` if name is a root, `NOTFOUND` otherwise
+		std::vector<uint32_t> rootNames;               // Name ids of the roots, in order of declaration
+		std::vector<uint32_t> rootInputs;              // Inputs declaring roots
+		uint32_t              newFlags = ctx.flags;    // creation flags
 
 		for (unsigned iFile = 0; iFile < numInputs; iFile++) {
+			input_t &input = inputs[iFile];
 
 			/*
 			 * Load input
 			 */
 
-			inputFilename = inputFilenames[iFile];
-			pOldTree      = new baseTree_t(ctx);
-
-			if (pOldTree->loadFile(inputFilename)) {
-				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("failed to load"));
-				json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
-				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-			}
+			inputFilename = input.name.c_str();
+			pOldTree      = loadInput(input);
 
 			if ((pOldTree->flags & context_t::MAGICMASK_SYSTEM) && iFile < numInputs - 1) {
 				json_t *jError = json_object();
@@ -160,11 +288,9 @@ struct bjoinContext_t {
 				json_delete(jResult);
 			}
 
-			// get number of roots for last input
-			if (iFile == numInputs - 1) {
-				newNumRoots = pOldTree->numRoots;
-				newKstart   = pOldTree->kstart;
-			}
+			input.kstart   = pOldTree->kstart;
+			input.numRoots = pOldTree->numRoots;
+			input.flags    = pOldTree->flags;
 
 			// is last a system
 			if (pOldTree->flags & context_t::MAGICMASK_SYSTEM)
@@ -173,67 +299,131 @@ struct bjoinContext_t {
 			/*
 			 * add entrypoints (inputs)
 			 */
+			input.entryIds.resize(pOldTree->nstart - pOldTree->kstart);
 			for (unsigned iEntry = pOldTree->kstart; iEntry < pOldTree->nstart; iEntry++) {
-				std::string name = pOldTree->entryNames[iEntry - pOldTree->kstart];
-				std::map<std::string, unsigned>::iterator it;
+				uint32_t id = names.insert(pOldTree->entryNames[iEntry - pOldTree->kstart]);
 
-				// does name exist as root
-				it = rootLookup.find(name);
-				if (it != rootLookup.end())
-					continue; // yes
-
-				// does name exist as entrypoint
-				it = entryLookup.find(name);
-				if (it != entryLookup.end())
-					continue; // yes
-
-				// add as new name	
-				entryLookup[name] = entryNames.size();
-				entryNames.push_back(name);
+				if (id == nameRoot.size())
+					nameRoot.push_back(NOTFOUND);
+
+				input.entryIds[iEntry - pOldTree->kstart] = id;
 			}
 
 			/*
 			 * add roots (outs)
 			 */
+			input.rootIds.resize(pOldTree->numRoots);
 			for (unsigned iRoot = 0; iRoot < pOldTree->numRoots; iRoot++) {
-				std::string name = pOldTree->rootNames[iRoot];
-				std::map<std::string, unsigned>::iterator it;
+				uint32_t id = names.insert(pOldTree->rootNames[iRoot]);
+
+				if (id == nameRoot.size())
+					nameRoot.push_back(NOTFOUND);
 
-				// does name exist as entrypoint
-				it = entryLookup.find(name);
-				if (it != entryLookup.end()) {
+				// does name exist as root
+				if (nameRoot[id] != NOTFOUND) {
 					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("root shadows an entrypoint"));
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("root already declared"));
 					json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
-					json_object_set_new_nocheck(jError, "name", json_string(name.c_str()));
+					json_object_set_new_nocheck(jError, "name", json_string(names.names[id].c_str()));
+					json_object_set_new_nocheck(jError, "previous", json_string(inputs[rootInputs[nameRoot[id]]].name.c_str()));
 					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
 
-				// does name exist as root
-				it = rootLookup.find(name);
-				if (it != rootLookup.end()) {
+				nameRoot[id] = rootNames.size();
+				rootNames.push_back(id);
+				rootInputs.push_back(iFile);
+
+				input.rootIds[iRoot] = id;
+			}
+
+			/*
+			 * Release input
+			 */
+			delete pOldTree;
+		}
+
+		/*
+		 * @date 2022-03-13 23:52:40
+		 *
+		 * Order inputs so that roots are imported before they are referenced as entrypoints.
+		 * Depth-first with an explicit stack, inputs already in order keep their order.
+		 */
+		std::vector<unsigned> schedule;                // Inputs in order of import
+		std::vector<uint8_t>  inputState(numInputs);   // 0=new, 1=on stack, 2=scheduled
+
+		for (unsigned iFile = 0; iFile < numInputs; iFile++) {
+			if (inputState[iFile] != 0)
+				continue;
+
+			std::vector<std::pair<unsigned, unsigned> > stack; // input, next entrypoint to examine
+
+			inputState[iFile] = 1;
+			stack.push_back(std::make_pair(iFile, 0U));
+
+			while (!stack.empty()) {
+				unsigned      iTop   = stack.back().first;
+				const input_t &input = inputs[iTop];
+
+				if (stack.back().second >= input.entryIds.size()) {
+					// all dependencies scheduled
+					inputState[iTop] = 2;
+					schedule.push_back(iTop);
+					stack.pop_back();
+					continue;
+				}
+
+				uint32_t id = input.entryIds[stack.back().second++];
+				if (nameRoot[id] == NOTFOUND)
+					continue; // regular entrypoint
+
+				unsigned iDep = rootInputs[nameRoot[id]];
+
+				if (inputState[iDep] == 1) {
 					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("root already declared"));
-					json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
-					json_object_set_new_nocheck(jError, "name", json_string(name.c_str()));
-					json_object_set_new_nocheck(jError, "previous", json_string(rootFiles[it->second].c_str()));
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("root shadows an entrypoint"));
+					json_object_set_new_nocheck(jError, "filename", json_string(input.name.c_str()));
+					json_object_set_new_nocheck(jError, "name", json_string(names.names[id].c_str()));
+					json_object_set_new_nocheck(jError, "declared", json_string(inputs[iDep].name.c_str()));
 					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
 
-				rootLookup[name] = rootNames.size();
-				rootNames.push_back(name);
-				rootFiles.push_back(inputFilename);
+				if (inputState[iDep] == 0) {
+					inputState[iDep] = 1;
+					stack.push_back(std::make_pair(iDep, 0U));
+				}
 			}
 		}
+		assert(schedule.size() == numInputs);
 
-		uint32_t newNstart = newKstart + entryNames.size();
+		// system must remain last
+		for (unsigned iOrder = 0; iOrder < numInputs - 1; iOrder++) {
+			if (inputs[schedule[iOrder]].flags & context_t::MAGICMASK_SYSTEM) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("only last input may be a system"));
+				json_object_set_new_nocheck(jError, "filename", json_string(inputs[schedule[iOrder]].name.c_str()));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+		}
 
-		// prepare global map
-		entryMap.resize(entryNames.size());
-		rootMap.resize(rootNames.size());
+		// get number of roots for last input
+		unsigned newNumRoots = inputs[schedule[numInputs - 1]].numRoots; // number of roots for last input
+		uint32_t newKstart   = inputs[schedule[numInputs - 1]].kstart;   // kstart of last input
 
-		for (unsigned iEntry = newKstart; iEntry < newNstart; iEntry++)
-			entryMap[iEntry - newKstart] = iEntry;
+		/*
+		 * Names that are not roots are entrypoints
+		 * `nameMap[]` holds the node id of entrypoints and the value of roots once imported
+		 */
+		std::vector<uint32_t> entryNames;                            // Name ids of the entries
+		std::vector<uint32_t> nameMap(names.size(), NOTFOUND); // Node id of names
+
+		for (uint32_t id = 0; id < names.size(); id++) {
+			if (nameRoot[id] == NOTFOUND) {
+				nameMap[id] = newKstart + entryNames.size();
+				entryNames.push_back(id);
+			}
+		}
+
+		uint32_t newNstart = newKstart + entryNames.size();
 
 		/*
 		 * Create new tree
@@ -248,7 +438,7 @@ struct bjoinContext_t {
 
 		pNewTree->entryNames.resize(entryNames.size());
 		for (unsigned iName = 0; iName < entryNames.size(); iName++)
-			pNewTree->entryNames[iName] = entryNames[iName];
+			pNewTree->entryNames[iName] = names.names[entryNames[iName]];
 
 		/*
 		 * Load inputs
@@ -261,17 +451,11 @@ struct bjoinContext_t {
 		// allocate a node remapper
 		uint32_t *pMap = pNewTree->allocMap();
 
-		for (unsigned iFile = 0; iFile < numInputs; iFile++) {
+		for (unsigned iOrder = 0; iOrder < numInputs; iOrder++) {
+			const input_t &input = inputs[schedule[iOrder]];
 
-			inputFilename = inputFilenames[iFile];
-			pOldTree      = new baseTree_t(ctx);
-
-			if (pOldTree->loadFile(inputFilename)) {
-				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("failed to load"));
-				json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
-				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-			}
+			inputFilename = input.name.c_str();
+			pOldTree      = loadInput(input);
 
 			ctx.progress++;
 			if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK) {
@@ -299,24 +483,8 @@ struct bjoinContext_t {
 			 */
 
 			for (unsigned iEntry = pOldTree->kstart; iEntry < pOldTree->nstart; iEntry++) {
-				std::string name = pOldTree->entryNames[iEntry - pOldTree->kstart];
-				std::map<std::string, unsigned>::iterator it;
-
-				// does name exist as root
-				it = rootLookup.find(name);
-				if (it != rootLookup.end()) {
-					pMap[iEntry] = rootMap[it->second];
-					continue;
-				}
-
-				// does name exist as entrypoint
-				it = entryLookup.find(name);
-				if (it != entryLookup.end()) {
-					pMap[iEntry] = entryMap[it->second];
-					continue;
-				}
-
-				assert(0); // may not reach here
+				pMap[iEntry] = nameMap[input.entryIds[iEntry - pOldTree->kstart]];
+				assert(pMap[iEntry] != NOTFOUND); // scheduled before declaration
 			}
 
 			/*
@@ -345,9 +513,9 @@ struct bjoinContext_t {
 				/*
 				 * balanced system and final tree
 				 */
-				assert(iFile == numInputs - 1);
+				assert(iOrder == numInputs - 1);
 
-				if (iFile == numInputs - 1) {
+				if (iOrder == numInputs - 1) {
 					// copy root names from last input 
 					pNewTree->rootNames.resize(newNumRoots);
 					for (unsigned iRoot = 0; iRoot < newNumRoots; iRoot++)
@@ -366,24 +534,17 @@ struct bjoinContext_t {
 				 * regular tree, match roots and copy values to global map
 				 */
 
-				if (iFile == numInputs - 1) {
+				if (iOrder == numInputs - 1) {
 					// copy root names from last input 
 					pNewTree->rootNames.resize(newNumRoots);
 					for (unsigned iRoot = 0; iRoot < newNumRoots; iRoot++)
-						pNewTree->rootNames[iRoot] = rootNames[iRoot];
+						pNewTree->rootNames[iRoot] = names.names[rootNames[iRoot]];
 				}
 
 				for (unsigned iRoot = 0; iRoot < pOldTree->numRoots; iRoot++) {
-					std::string name = pOldTree->rootNames[iRoot];
-					std::map<std::string, unsigned>::iterator it;
-
-					// does name exist as root
-					it = rootLookup.find(name);
-					assert (it != rootLookup.end());
-
 					uint32_t R = pOldTree->roots[iRoot];
 
-					rootMap[it->second] = pMap[R & ~IBIT] ^ (R & IBIT);
+					nameMap[input.rootIds[iRoot]] = pMap[R & ~IBIT] ^ (R & IBIT);
 				}
 			}
 
@@ -423,7 +584,6 @@ struct bjoinContext_t {
 		return 0;
 	}
 
-
 };
 
 /*
@@ -435,7 +595,7 @@ struct bjoinContext_t {
 bjoinContext_t app;
 
 void usage(char *argv[], bool verbose) {
-	fprintf(stderr, "usage: %s <output.dat> <input.dat> ...\n", argv[0]);
+	fprintf(stderr, "usage: %s <output.dat> <input.dat> ... # NOTE: inputs can be slice containers\n", argv[0]);
 	if (verbose) {
 		fprintf(stderr, "\t   --extend\n");
 		fprintf(stderr, "\t   --force\n");
@@ -120,15 +120,33 @@ struct bsaveContext_t {
 			// add names/history
 			pTree->extraInfo(jOutput);
 
-			// add data as strings
-			json_object_set_new_nocheck(jOutput, "data", json_string_nocheck(pTree->saveString(0, NULL, true).c_str()));
-
 			FILE *f = fopen(outputFilename, "w");
 			if (!f)
 				ctx.fatal("fopen(%s) returned: %m\n", outputFilename);
 
-			fprintf(f, "%s\n", json_dumps(jOutput, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			/*
+			 * @date 2022-03-14 00:13:02
+			 *
+			 * Stream data as last member instead of building it as json string.
+			 * Notation only contains characters that need no escaping.
+			 */
+			char   *pMeta  = json_dumps(jOutput, JSON_PRESERVE_ORDER | JSON_COMPACT);
+			size_t metaLen = strlen(pMeta);
+
+			assert(metaLen >= 2 && pMeta[metaLen - 1] == '}');
+
+			// meta without closing brace
+			fwrite(pMeta, metaLen - 1, 1, f);
+			fprintf(f, "%s\"data\":\"", metaLen > 2 ? "," : "");
+			// add data as strings
+			pTree->saveString(f, 0, NULL, true);
+			fprintf(f, "\"}\n");
+
+			free(pMeta);
+			json_delete(jOutput);
 
+			if (ferror(f))
+				ctx.fatal("ferror(%s) returned: %m\n", outputFilename);
 			if (fclose(f))
 				ctx.fatal("fclose(%s) returned: %m\n", outputFilename);
 
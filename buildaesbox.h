@@ -1,1054 +1,1067 @@
-NODE __attribute__((optimize("O0"))) ZBOX0(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _05 = NODE(in2,in0,_00^IBIT);
-NODE _06 = NODE(in2,_00,in7^IBIT);
-NODE _07 = NODE(in2,_02,0);
-NODE _08 = NODE(in1,_06,_07^IBIT);
-NODE _09 = NODE(in2,_00,_01^IBIT);
-NODE _10 = NODE(in2,in0,_01^IBIT);
-NODE _11 = NODE(in1,_09,_10);
-NODE _12 = NODE(in2,in7,_04^IBIT);
-NODE _13 = NODE(in2,in7,_04);
-NODE _14 = NODE(in1,_12,_13^IBIT);
-NODE _15 = NODE(in2,_00,in0^IBIT);
-NODE _16 = NODE(in2,_01,_04);
-NODE _17 = NODE(in1,_15,_16);
-NODE _18 = NODE(in2,_01,in7);
-NODE _19 = NODE(in2,0,_02);
-NODE _20 = NODE(in1,_18,_19^IBIT);
-NODE _21 = NODE(in2,in0,_02);
-NODE _22 = NODE(in1,_15,_21^IBIT);
-NODE _23 = NODE(in2,_02,in0^IBIT);
-NODE _24 = NODE(in2,in7,IBIT);
-NODE _25 = NODE(in1,_23,_24);
-NODE _26 = NODE(in2,_00,0);
-NODE _27 = NODE(in2,_01,_02);
-NODE _28 = NODE(in1,_26,_27);
-NODE _29 = NODE(in2,_03,_00);
-NODE _30 = NODE(in2,_03,in7);
-NODE _31 = NODE(in1,_29,_30^IBIT);
-NODE _32 = NODE(in2,in7,_01);
-NODE _33 = NODE(in2,_04,_02^IBIT);
-NODE _34 = NODE(in1,_32,_33);
-NODE _35 = NODE(in2,in7,in0);
-NODE _36 = NODE(in1,_26,_35);
-NODE _37 = NODE(in2,0,_02^IBIT);
-NODE _38 = NODE(in2,_01,_03);
-NODE _39 = NODE(in1,_37,_38);
-NODE _40 = NODE(in2,_04,in0^IBIT);
-NODE _41 = NODE(in2,_01,_00^IBIT);
-NODE _42 = NODE(in1,_40,_41);
-NODE _43 = NODE(in2,_01,_02^IBIT);
-NODE _44 = NODE(in1,_43,_04);
-NODE _45 = NODE(in2,_04,_04^IBIT);
-NODE _46 = NODE(in1,_35,_45^IBIT);
-NODE _47 = NODE(in4,_05,_28);
-NODE _48 = NODE(in4,_08,_31^IBIT);
-NODE _49 = NODE(in4,_11,_34);
-NODE _50 = NODE(in4,_14,_36);
-NODE _51 = NODE(in4,_17,_39^IBIT);
-NODE _52 = NODE(in4,_20,_42^IBIT);
-NODE _53 = NODE(in4,_22,_44^IBIT);
-NODE _54 = NODE(in4,_25,_46);
-NODE _55 = NODE(in6,_47,_51);
-NODE _56 = NODE(in6,_48,_52);
-NODE _57 = NODE(in6,_49,_53^IBIT);
-NODE _58 = NODE(in6,_50,_54);
-NODE _59 = NODE(in5,_55,_57);
-NODE _60 = NODE(in5,_56,_58^IBIT);
-NODE _61 = NODE(in3,_59,_60^IBIT);
-return _61^IBIT;
-}
-NODE __attribute__((optimize("O0"))) ZBOX1(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _09 = NODE(in2,_00,_01^IBIT);
-NODE _10 = NODE(in2,in0,_01^IBIT);
-NODE _12 = NODE(in2,in7,_04^IBIT);
-NODE _18 = NODE(in2,_01,in7);
-NODE _19 = NODE(in2,0,_02);
-NODE _30 = NODE(in2,_03,in7);
-NODE _62 = NODE(in2,in0,_03);
-NODE _63 = NODE(in1,_02,_62^IBIT);
-NODE _64 = NODE(in2,in0,_03^IBIT);
-NODE _65 = NODE(in2,_01,_03^IBIT);
-NODE _66 = NODE(in1,_64,_65^IBIT);
-NODE _67 = NODE(in0,in2,IBIT);
-NODE _68 = NODE(in1,_62,_67^IBIT);
-NODE _69 = NODE(in2,0,_03);
-NODE _70 = NODE(in1,_69,_18^IBIT);
-NODE _71 = NODE(in1,_12,_12^IBIT);
-NODE _72 = NODE(in2,in7,_02^IBIT);
-NODE _73 = NODE(in2,_03,0);
-NODE _74 = NODE(in1,_72,_73^IBIT);
-NODE _75 = NODE(in2,_00,_00^IBIT);
-NODE _76 = NODE(in2,_03,_04^IBIT);
-NODE _77 = NODE(in1,_75,_76^IBIT);
-NODE _78 = NODE(in2,in0,in7);
-NODE _79 = NODE(in1,_10,_78);
-NODE _80 = NODE(in2,in7,in0^IBIT);
-NODE _81 = NODE(in1,_03,_80);
-NODE _82 = NODE(in2,_01,0);
-NODE _83 = NODE(in1,_82,_30);
-NODE _84 = NODE(in2,_01,_01^IBIT);
-NODE _85 = NODE(in2,_00,_04);
-NODE _86 = NODE(in1,_84,_85);
-NODE _87 = NODE(in2,_01,IBIT);
-NODE _88 = NODE(in2,_00,_04^IBIT);
-NODE _89 = NODE(in1,_87,_88);
-NODE _90 = NODE(in2,0,in7^IBIT);
-NODE _91 = NODE(in1,_90,_12^IBIT);
-NODE _92 = NODE(in1,_19,_09);
-NODE _93 = NODE(in2,_02,IBIT);
-NODE _94 = NODE(in2,in7,_03^IBIT);
-NODE _95 = NODE(in1,_93,_94^IBIT);
-NODE _96 = NODE(in2,_02,_04^IBIT);
-NODE _97 = NODE(in1,_96,_90^IBIT);
-NODE _98 = NODE(in4,_63,_81);
-NODE _99 = NODE(in4,_66,_83);
-NODE _100 = NODE(in4,_68,_86);
-NODE _101 = NODE(in4,_70,_89^IBIT);
-NODE _102 = NODE(in4,_71,_91^IBIT);
-NODE _103 = NODE(in4,_74,_92^IBIT);
-NODE _104 = NODE(in4,_77,_95);
-NODE _105 = NODE(in4,_79,_97);
-NODE _106 = NODE(in6,_98,_102^IBIT);
-NODE _107 = NODE(in6,_99,_103);
-NODE _108 = NODE(in6,_100,_104^IBIT);
-NODE _109 = NODE(in6,_101,_105^IBIT);
-NODE _110 = NODE(in5,_106,_108^IBIT);
-NODE _111 = NODE(in5,_107,_109);
-NODE _112 = NODE(in3,_110,_111);
-return _112^IBIT;
-}
-NODE __attribute__((optimize("O0"))) ZBOX2(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _05 = NODE(in2,in0,_00^IBIT);
-NODE _23 = NODE(in2,_02,in0^IBIT);
-NODE _29 = NODE(in2,_03,_00);
-NODE _32 = NODE(in2,in7,_01);
-NODE _35 = NODE(in2,in7,in0);
-NODE _37 = NODE(in2,0,_02^IBIT);
-NODE _75 = NODE(in2,_00,_00^IBIT);
-NODE _84 = NODE(in2,_01,_01^IBIT);
-NODE _88 = NODE(in2,_00,_04^IBIT);
-NODE _94 = NODE(in2,in7,_03^IBIT);
-NODE _113 = NODE(in2,_01,_04^IBIT);
-NODE _114 = NODE(in2,_00,_02);
-NODE _115 = NODE(in1,_113,_114);
-NODE _116 = NODE(in2,in0,_02^IBIT);
-NODE _117 = NODE(in1,_05,_116);
-NODE _118 = NODE(in2,_02,in7^IBIT);
-NODE _119 = NODE(in1,_118,_04);
-NODE _120 = NODE(in2,_01,_00);
-NODE _121 = NODE(in1,_35,_120);
-NODE _122 = NODE(in2,_02,_03^IBIT);
-NODE _123 = NODE(in1,_94,_122);
-NODE _124 = NODE(in2,_03,_03^IBIT);
-NODE _125 = NODE(in1,_124,_84);
-NODE _126 = NODE(in2,_03,_01^IBIT);
-NODE _127 = NODE(in2,_04,in0);
-NODE _128 = NODE(in1,_126,_127);
-NODE _129 = NODE(in2,_04,_01^IBIT);
-NODE _130 = NODE(in2,0,_01^IBIT);
-NODE _131 = NODE(in1,_129,_130^IBIT);
-NODE _132 = NODE(in1,_88,_75);
-NODE _133 = NODE(in1,_23,_29^IBIT);
-NODE _134 = NODE(in1,_32,_00^IBIT);
-NODE _135 = NODE(in2,_02,_01^IBIT);
-NODE _136 = NODE(in2,_04,in7^IBIT);
-NODE _137 = NODE(in1,_135,_136);
-NODE _138 = NODE(in2,_03,_00^IBIT);
-NODE _139 = NODE(in1,_37,_138^IBIT);
-NODE _140 = NODE(in2,_01,in0^IBIT);
-NODE _141 = NODE(in1,_00,_140^IBIT);
-NODE _142 = NODE(in2,_00,in0);
-NODE _143 = NODE(in1,_75,_142^IBIT);
-NODE _144 = NODE(in2,in7,_01^IBIT);
-NODE _145 = NODE(in2,_00,_01);
-NODE _146 = NODE(in1,_144,_145);
-NODE _147 = NODE(in4,_115,_132);
-NODE _148 = NODE(in4,_117,_133);
-NODE _149 = NODE(in4,_119,_134^IBIT);
-NODE _150 = NODE(in4,_121,_137^IBIT);
-NODE _151 = NODE(in4,_123,_139);
-NODE _152 = NODE(in4,_125,_141);
-NODE _153 = NODE(in4,_128,_143^IBIT);
-NODE _154 = NODE(in4,_131,_146^IBIT);
-NODE _155 = NODE(in6,_147,_151);
-NODE _156 = NODE(in6,_148,_152);
-NODE _157 = NODE(in6,_149,_153^IBIT);
-NODE _158 = NODE(in6,_150,_154);
-NODE _159 = NODE(in5,_155,_157^IBIT);
-NODE _160 = NODE(in5,_156,_158^IBIT);
-NODE _161 = NODE(in3,_159,_160);
-return _161;
-}
-NODE __attribute__((optimize("O0"))) ZBOX3(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _13 = NODE(in2,in7,_04);
-NODE _15 = NODE(in2,_00,in0^IBIT);
-NODE _29 = NODE(in2,_03,_00);
-NODE _65 = NODE(in2,_01,_03^IBIT);
-NODE _73 = NODE(in2,_03,0);
-NODE _75 = NODE(in2,_00,_00^IBIT);
-NODE _80 = NODE(in2,in7,in0^IBIT);
-NODE _82 = NODE(in2,_01,0);
-NODE _85 = NODE(in2,_00,_04);
-NODE _90 = NODE(in2,0,in7^IBIT);
-NODE _93 = NODE(in2,_02,IBIT);
-NODE _120 = NODE(in2,_01,_00);
-NODE _126 = NODE(in2,_03,_01^IBIT);
-NODE _127 = NODE(in2,_04,in0);
-NODE _129 = NODE(in2,_04,_01^IBIT);
-NODE _135 = NODE(in2,_02,_01^IBIT);
-NODE _142 = NODE(in2,_00,in0);
-NODE _162 = NODE(in2,_03,in7^IBIT);
-NODE _163 = NODE(in1,_120,_162^IBIT);
-NODE _164 = NODE(in1,_75,_15^IBIT);
-NODE _165 = NODE(in1,_82,_29^IBIT);
-NODE _166 = NODE(in2,in0,_04^IBIT);
-NODE _167 = NODE(in1,_166,_129);
-NODE _168 = NODE(in1,_80,_126);
-NODE _169 = NODE(in2,_00,_03^IBIT);
-NODE _170 = NODE(in2,_02,in0);
-NODE _171 = NODE(in1,_169,_170^IBIT);
-NODE _172 = NODE(in1,_93,_135);
-NODE _173 = NODE(in2,_02,_00);
-NODE _174 = NODE(in1,_173,_90);
-NODE _175 = NODE(in2,_04,_02);
-NODE _176 = NODE(in2,_00,in7);
-NODE _177 = NODE(in1,_175,_176^IBIT);
-NODE _178 = NODE(in1,_13,_127);
-NODE _179 = NODE(in2,in7,_00);
-NODE _180 = NODE(in1,_65,_179^IBIT);
-NODE _181 = NODE(in2,in0,_00);
-NODE _182 = NODE(in0,in2,0);
-NODE _183 = NODE(in1,_181,_182^IBIT);
-NODE _184 = NODE(in2,0,_04);
-NODE _185 = NODE(in1,_184,_142);
-NODE _186 = NODE(in1,_142,_73);
-NODE _187 = NODE(in1,_85,in2^IBIT);
-NODE _188 = NODE(in2,_03,_01);
-NODE _189 = NODE(in1,in0,_188^IBIT);
-NODE _190 = NODE(in4,_163,_177^IBIT);
-NODE _191 = NODE(in4,_164,_178^IBIT);
-NODE _192 = NODE(in4,_165,_180^IBIT);
-NODE _193 = NODE(in4,_167,_183);
-NODE _194 = NODE(in4,_168,_185^IBIT);
-NODE _195 = NODE(in4,_171,_186^IBIT);
-NODE _196 = NODE(in4,_172,_187);
-NODE _197 = NODE(in4,_174,_189);
-NODE _198 = NODE(in6,_190,_194^IBIT);
-NODE _199 = NODE(in6,_191,_195^IBIT);
-NODE _200 = NODE(in6,_192,_196);
-NODE _201 = NODE(in6,_193,_197^IBIT);
-NODE _202 = NODE(in5,_198,_200);
-NODE _203 = NODE(in5,_199,_201^IBIT);
-NODE _204 = NODE(in3,_202,_203^IBIT);
-return _204;
-}
-NODE __attribute__((optimize("O0"))) ZBOX4(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _06 = NODE(in2,_00,in7^IBIT);
-NODE _07 = NODE(in2,_02,0);
-NODE _09 = NODE(in2,_00,_01^IBIT);
-NODE _30 = NODE(in2,_03,in7);
-NODE _32 = NODE(in2,in7,_01);
-NODE _40 = NODE(in2,_04,in0^IBIT);
-NODE _72 = NODE(in2,in7,_02^IBIT);
-NODE _73 = NODE(in2,_03,0);
-NODE _76 = NODE(in2,_03,_04^IBIT);
-NODE _80 = NODE(in2,in7,in0^IBIT);
-NODE _90 = NODE(in2,0,in7^IBIT);
-NODE _93 = NODE(in2,_02,IBIT);
-NODE _113 = NODE(in2,_01,_04^IBIT);
-NODE _126 = NODE(in2,_03,_01^IBIT);
-NODE _130 = NODE(in2,0,_01^IBIT);
-NODE _135 = NODE(in2,_02,_01^IBIT);
-NODE _140 = NODE(in2,_01,in0^IBIT);
-NODE _175 = NODE(in2,_04,_02);
-NODE _176 = NODE(in2,_00,in7);
-NODE _181 = NODE(in2,in0,_00);
-NODE _184 = NODE(in2,0,_04);
-NODE _188 = NODE(in2,_03,_01);
-NODE _205 = NODE(in0,0,in2);
-NODE _206 = NODE(in1,_140,_205^IBIT);
-NODE _207 = NODE(in1,_72,_32);
-NODE _208 = NODE(in1,_40,_135^IBIT);
-NODE _209 = NODE(in1,_93,_113^IBIT);
-NODE _210 = NODE(in2,0,in7);
-NODE _211 = NODE(in1,_06,_210);
-NODE _212 = NODE(in1,_80,in2);
-NODE _213 = NODE(in0,in2,in2^IBIT);
-NODE _214 = NODE(in2,_02,_00^IBIT);
-NODE _215 = NODE(in1,_213,_214);
-NODE _216 = NODE(in2,in0,_01);
-NODE _217 = NODE(in1,_181,_216^IBIT);
-NODE _218 = NODE(in2,0,_03^IBIT);
-NODE _219 = NODE(in1,_188,_218);
-NODE _220 = NODE(in1,_76,_130);
-NODE _221 = NODE(in2,0,_04^IBIT);
-NODE _222 = NODE(in1,_221,_07);
-NODE _223 = NODE(in1,_03,_30^IBIT);
-NODE _224 = NODE(in1,_09,_73);
-NODE _225 = NODE(in1,_90,_175);
-NODE _226 = NODE(in2,in0,in7^IBIT);
-NODE _227 = NODE(in1,_176,_226^IBIT);
-NODE _228 = NODE(in1,_184,_126);
-NODE _229 = NODE(in4,_206,_219^IBIT);
-NODE _230 = NODE(in4,_207,_220^IBIT);
-NODE _231 = NODE(in4,_208,_222^IBIT);
-NODE _232 = NODE(in4,_209,_223^IBIT);
-NODE _233 = NODE(in4,_211,_224^IBIT);
-NODE _234 = NODE(in4,_212,_225);
-NODE _235 = NODE(in4,_215,_227);
-NODE _236 = NODE(in4,_217,_228^IBIT);
-NODE _237 = NODE(in6,_229,_233^IBIT);
-NODE _238 = NODE(in6,_230,_234^IBIT);
-NODE _239 = NODE(in6,_231,_235^IBIT);
-NODE _240 = NODE(in6,_232,_236^IBIT);
-NODE _241 = NODE(in5,_237,_239^IBIT);
-NODE _242 = NODE(in5,_238,_240);
-NODE _243 = NODE(in3,_241,_242^IBIT);
-return _243;
-}
-NODE __attribute__((optimize("O0"))) ZBOX5(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _09 = NODE(in2,_00,_01^IBIT);
-NODE _65 = NODE(in2,_01,_03^IBIT);
-NODE _80 = NODE(in2,in7,in0^IBIT);
-NODE _82 = NODE(in2,_01,0);
-NODE _87 = NODE(in2,_01,IBIT);
-NODE _88 = NODE(in2,_00,_04^IBIT);
-NODE _94 = NODE(in2,in7,_03^IBIT);
-NODE _116 = NODE(in2,in0,_02^IBIT);
-NODE _136 = NODE(in2,_04,in7^IBIT);
-NODE _162 = NODE(in2,_03,in7^IBIT);
-NODE _170 = NODE(in2,_02,in0);
-NODE _173 = NODE(in2,_02,_00);
-NODE _175 = NODE(in2,_04,_02);
-NODE _205 = NODE(in0,0,in2);
-NODE _210 = NODE(in2,0,in7);
-NODE _214 = NODE(in2,_02,_00^IBIT);
-NODE _244 = NODE(in1,_210,in7^IBIT);
-NODE _245 = NODE(in2,in7,in7^IBIT);
-NODE _246 = NODE(in2,_04,_00);
-NODE _247 = NODE(in1,_245,_246);
-NODE _248 = NODE(in1,_136,_116);
-NODE _249 = NODE(in1,_162,_170);
-NODE _250 = NODE(in2,0,_01);
-NODE _251 = NODE(in1,in2,_250);
-NODE _252 = NODE(in1,_170,_88^IBIT);
-NODE _253 = NODE(in2,in0,_04);
-NODE _254 = NODE(in1,_94,_253);
-NODE _255 = NODE(in1,_175,_173^IBIT);
-NODE _256 = NODE(in1,_09,_03^IBIT);
-NODE _257 = NODE(in1,_04,_214^IBIT);
-NODE _258 = NODE(in2,_02,_03);
-NODE _259 = NODE(in1,_258,_205^IBIT);
-NODE _260 = NODE(in1,_82,_80);
-NODE _261 = NODE(in2,_04,0);
-NODE _262 = NODE(in1,_261,_246);
-NODE _263 = NODE(in1,_253,_87^IBIT);
-NODE _264 = NODE(in1,_258,_65^IBIT);
-NODE _265 = NODE(in1,_253,_01^IBIT);
-NODE _266 = NODE(in4,_244,_256^IBIT);
-NODE _267 = NODE(in4,_247,_257^IBIT);
-NODE _268 = NODE(in4,_248,_259);
-NODE _269 = NODE(in4,_249,_260);
-NODE _270 = NODE(in4,_251,_262^IBIT);
-NODE _271 = NODE(in4,_252,_263^IBIT);
-NODE _272 = NODE(in4,_254,_264^IBIT);
-NODE _273 = NODE(in4,_255,_265^IBIT);
-NODE _274 = NODE(in6,_266,_270^IBIT);
-NODE _275 = NODE(in6,_267,_271^IBIT);
-NODE _276 = NODE(in6,_268,_272^IBIT);
-NODE _277 = NODE(in6,_269,_273^IBIT);
-NODE _278 = NODE(in5,_274,_276);
-NODE _279 = NODE(in5,_275,_277);
-NODE _280 = NODE(in3,_278,_279^IBIT);
-return _280;
-}
-NODE __attribute__((optimize("O0"))) ZBOX6(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _09 = NODE(in2,_00,_01^IBIT);
-NODE _15 = NODE(in2,_00,in0^IBIT);
-NODE _21 = NODE(in2,in0,_02);
-NODE _27 = NODE(in2,_01,_02);
-NODE _29 = NODE(in2,_03,_00);
-NODE _33 = NODE(in2,_04,_02^IBIT);
-NODE _35 = NODE(in2,in7,in0);
-NODE _45 = NODE(in2,_04,_04^IBIT);
-NODE _72 = NODE(in2,in7,_02^IBIT);
-NODE _76 = NODE(in2,_03,_04^IBIT);
-NODE _80 = NODE(in2,in7,in0^IBIT);
-NODE _85 = NODE(in2,_00,_04);
-NODE _114 = NODE(in2,_00,_02);
-NODE _126 = NODE(in2,_03,_01^IBIT);
-NODE _127 = NODE(in2,_04,in0);
-NODE _135 = NODE(in2,_02,_01^IBIT);
-NODE _162 = NODE(in2,_03,in7^IBIT);
-NODE _218 = NODE(in2,0,_03^IBIT);
-NODE _246 = NODE(in2,_04,_00);
-NODE _281 = NODE(in1,_15,_04^IBIT);
-NODE _282 = NODE(in1,0,_80);
-NODE _283 = NODE(in2,_04,_03^IBIT);
-NODE _284 = NODE(in2,_00,IBIT);
-NODE _285 = NODE(in1,_283,_284^IBIT);
-NODE _286 = NODE(in1,_35,_135);
-NODE _287 = NODE(in1,_45,_03);
-NODE _288 = NODE(in0,0,in2^IBIT);
-NODE _289 = NODE(in1,_288,_127^IBIT);
-NODE _290 = NODE(in1,_162,_218^IBIT);
-NODE _291 = NODE(in1,_15,_114^IBIT);
-NODE _292 = NODE(in2,in7,_00^IBIT);
-NODE _293 = NODE(in1,_218,_292);
-NODE _294 = NODE(in2,_04,_03);
-NODE _295 = NODE(in1,_294,_21);
-NODE _296 = NODE(in1,_246,_33);
-NODE _297 = NODE(in1,_27,_72^IBIT);
-NODE _298 = NODE(in1,_126,_76);
-NODE _299 = NODE(in2,in7,_03);
-NODE _300 = NODE(in1,_29,_299);
-NODE _301 = NODE(in2,_04,in7);
-NODE _302 = NODE(in1,_80,_301);
-NODE _303 = NODE(in1,_85,_09);
-NODE _304 = NODE(in4,_281,_293);
-NODE _305 = NODE(in4,_282,_295^IBIT);
-NODE _306 = NODE(in4,_285,_296);
-NODE _307 = NODE(in4,_286,_297^IBIT);
-NODE _308 = NODE(in4,_287,_298^IBIT);
-NODE _309 = NODE(in4,_289,_300);
-NODE _310 = NODE(in4,_290,_302^IBIT);
-NODE _311 = NODE(in4,_291,_303);
-NODE _312 = NODE(in6,_304,_308);
-NODE _313 = NODE(in6,_305,_309^IBIT);
-NODE _314 = NODE(in6,_306,_310);
-NODE _315 = NODE(in6,_307,_311^IBIT);
-NODE _316 = NODE(in5,_312,_314);
-NODE _317 = NODE(in5,_313,_315);
-NODE _318 = NODE(in3,_316,_317);
-return _318;
-}
-NODE __attribute__((optimize("O0"))) ZBOX7(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,0,in7);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,in7,in7^IBIT);
-NODE _05 = NODE(in2,in0,_00^IBIT);
-NODE _07 = NODE(in2,_02,0);
-NODE _10 = NODE(in2,in0,_01^IBIT);
-NODE _12 = NODE(in2,in7,_04^IBIT);
-NODE _13 = NODE(in2,in7,_04);
-NODE _24 = NODE(in2,in7,IBIT);
-NODE _26 = NODE(in2,_00,0);
-NODE _43 = NODE(in2,_01,_02^IBIT);
-NODE _65 = NODE(in2,_01,_03^IBIT);
-NODE _69 = NODE(in2,0,_03);
-NODE _72 = NODE(in2,in7,_02^IBIT);
-NODE _80 = NODE(in2,in7,in0^IBIT);
-NODE _87 = NODE(in2,_01,IBIT);
-NODE _96 = NODE(in2,_02,_04^IBIT);
-NODE _122 = NODE(in2,_02,_03^IBIT);
-NODE _136 = NODE(in2,_04,in7^IBIT);
-NODE _140 = NODE(in2,_01,in0^IBIT);
-NODE _162 = NODE(in2,_03,in7^IBIT);
-NODE _169 = NODE(in2,_00,_03^IBIT);
-NODE _179 = NODE(in2,in7,_00);
-NODE _184 = NODE(in2,0,_04);
-NODE _188 = NODE(in2,_03,_01);
-NODE _246 = NODE(in2,_04,_00);
-NODE _258 = NODE(in2,_02,_03);
-NODE _299 = NODE(in2,in7,_03);
-NODE _319 = NODE(in1,_12,_43);
-NODE _320 = NODE(in1,_136,_02^IBIT);
-NODE _321 = NODE(in1,_169,_162^IBIT);
-NODE _322 = NODE(in1,_184,_299^IBIT);
-NODE _323 = NODE(in2,_03,_02^IBIT);
-NODE _324 = NODE(in1,_26,_323^IBIT);
-NODE _325 = NODE(in1,_184,_188);
-NODE _326 = NODE(in1,0,_07^IBIT);
-NODE _327 = NODE(in2,_00,_03);
-NODE _328 = NODE(in1,_327,_96);
-NODE _329 = NODE(in1,_87,_122^IBIT);
-NODE _330 = NODE(in2,_04,_00^IBIT);
-NODE _331 = NODE(in1,_24,_330^IBIT);
-NODE _332 = NODE(in1,_258,_140);
-NODE _333 = NODE(in1,_10,_72^IBIT);
-NODE _334 = NODE(in1,_65,_13^IBIT);
-NODE _335 = NODE(in1,_80,_179^IBIT);
-NODE _336 = NODE(in1,_69,_43);
-NODE _337 = NODE(in1,_246,_05);
-NODE _338 = NODE(in4,_319,_329^IBIT);
-NODE _339 = NODE(in4,_320,_331);
-NODE _340 = NODE(in4,_321,_332);
-NODE _341 = NODE(in4,_322,_333);
-NODE _342 = NODE(in4,_324,_334^IBIT);
-NODE _343 = NODE(in4,_325,_335^IBIT);
-NODE _344 = NODE(in4,_326,_336);
-NODE _345 = NODE(in4,_328,_337^IBIT);
-NODE _346 = NODE(in6,_338,_342^IBIT);
-NODE _347 = NODE(in6,_339,_343);
-NODE _348 = NODE(in6,_340,_344^IBIT);
-NODE _349 = NODE(in6,_341,_345^IBIT);
-NODE _350 = NODE(in5,_346,_348^IBIT);
-NODE _351 = NODE(in5,_347,_349^IBIT);
-NODE _352 = NODE(in3,_350,_351^IBIT);
-return _352^IBIT;
-}
-NODE __attribute__((optimize("O0"))) SBOX0(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _05 = NODE(in4,in0,_02^IBIT);
-NODE _06 = NODE(in4,_00,_04);
-NODE _07 = NODE(in4,_00,_01^IBIT);
-NODE _08 = NODE(in4,_01,_00^IBIT);
-NODE _09 = NODE(in4,_00,in7);
-NODE _10 = NODE(in4,_02,_03);
-NODE _11 = NODE(in4,_02,0);
-NODE _12 = NODE(in4,in7,_02^IBIT);
-NODE _13 = NODE(in4,0,in7^IBIT);
-NODE _14 = NODE(in4,in7,_01^IBIT);
-NODE _15 = NODE(in4,_03,in0);
-NODE _16 = NODE(in4,_03,in0^IBIT);
-NODE _17 = NODE(in4,0,_03^IBIT);
-NODE _18 = NODE(in4,_04,_02);
-NODE _19 = NODE(in4,_02,in7);
-NODE _20 = NODE(in4,_02,in0);
-NODE _21 = NODE(in4,in7,_00);
-NODE _22 = NODE(in4,_01,IBIT);
-NODE _23 = NODE(in0,in4,IBIT);
-NODE _24 = NODE(in4,in7,IBIT);
-NODE _25 = NODE(in4,_03,_04^IBIT);
-NODE _26 = NODE(in4,_01,_03);
-NODE _27 = NODE(in4,_00,_03);
-NODE _28 = NODE(in4,_02,_04^IBIT);
-NODE _29 = NODE(in4,_01,in0^IBIT);
-NODE _30 = NODE(in5,_05,_20);
-NODE _31 = NODE(in5,_06,_21^IBIT);
-NODE _32 = NODE(in5,_07,_22^IBIT);
-NODE _33 = NODE(in5,_08,_23);
-NODE _34 = NODE(in5,_09,_24);
-NODE _35 = NODE(in5,_10,_25);
-NODE _36 = NODE(in5,_11,_26^IBIT);
-NODE _37 = NODE(in5,_12,_27^IBIT);
-NODE _38 = NODE(in5,_03,_16);
-NODE _39 = NODE(in5,_13,_06^IBIT);
-NODE _40 = NODE(in5,_14,_16^IBIT);
-NODE _41 = NODE(in5,_16,_28);
-NODE _42 = NODE(in5,_17,_01);
-NODE _43 = NODE(in5,_18,in7);
-NODE _44 = NODE(in5,_19,_29^IBIT);
-NODE _45 = NODE(in2,_30,_38);
-NODE _46 = NODE(in2,_31,_39^IBIT);
-NODE _47 = NODE(in2,_32,_40^IBIT);
-NODE _48 = NODE(in2,_33,_15^IBIT);
-NODE _49 = NODE(in2,_34,_41);
-NODE _50 = NODE(in2,_35,_42^IBIT);
-NODE _51 = NODE(in2,_36,_43);
-NODE _52 = NODE(in2,_37,_44^IBIT);
-NODE _53 = NODE(in3,_45,_49);
-NODE _54 = NODE(in3,_46,_50^IBIT);
-NODE _55 = NODE(in3,_47,_51);
-NODE _56 = NODE(in3,_48,_52^IBIT);
-NODE _57 = NODE(in1,_53,_55);
-NODE _58 = NODE(in1,_54,_56);
-NODE _59 = NODE(in6,_57,_58);
-return _59;
-}
-NODE __attribute__((optimize("O0"))) SBOX1(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _06 = NODE(in4,_00,_04);
-NODE _09 = NODE(in4,_00,in7);
-NODE _27 = NODE(in4,_00,_03);
-NODE _60 = NODE(in4,0,_02^IBIT);
-NODE _61 = NODE(in0,0,in4);
-NODE _62 = NODE(in4,_00,_04^IBIT);
-NODE _63 = NODE(in4,_04,IBIT);
-NODE _64 = NODE(in4,_04,in0^IBIT);
-NODE _65 = NODE(in4,_02,_03^IBIT);
-NODE _66 = NODE(in4,_02,_01^IBIT);
-NODE _67 = NODE(in4,in0,_01);
-NODE _68 = NODE(in4,_00,in7^IBIT);
-NODE _69 = NODE(in4,_04,in7^IBIT);
-NODE _70 = NODE(in4,_01,0);
-NODE _71 = NODE(in4,_02,_02^IBIT);
-NODE _72 = NODE(in4,in0,_00);
-NODE _73 = NODE(in4,in0,_02);
-NODE _74 = NODE(in4,in7,in7^IBIT);
-NODE _75 = NODE(in4,_03,_02^IBIT);
-NODE _76 = NODE(in4,_03,_02);
-NODE _77 = NODE(in4,_01,_04^IBIT);
-NODE _78 = NODE(in4,_00,IBIT);
-NODE _79 = NODE(in4,in0,_04);
-NODE _80 = NODE(in4,in7,_01);
-NODE _81 = NODE(in4,_01,in0);
-NODE _82 = NODE(in4,_04,_01^IBIT);
-NODE _83 = NODE(in4,in7,_03^IBIT);
-NODE _84 = NODE(in5,_60,_72^IBIT);
-NODE _85 = NODE(in5,_61,_62);
-NODE _86 = NODE(in5,_62,_73);
-NODE _87 = NODE(in5,_63,_74^IBIT);
-NODE _88 = NODE(in5,_64,_75^IBIT);
-NODE _89 = NODE(in5,_65,_76^IBIT);
-NODE _90 = NODE(in5,_27,_77);
-NODE _91 = NODE(in5,_06,_78^IBIT);
-NODE _92 = NODE(in5,_66,_79^IBIT);
-NODE _93 = NODE(in5,_67,_80^IBIT);
-NODE _94 = NODE(in5,_68,in7);
-NODE _95 = NODE(in5,_69,_80^IBIT);
-NODE _96 = NODE(in5,_09,_81^IBIT);
-NODE _97 = NODE(in5,_70,_82^IBIT);
-NODE _98 = NODE(in5,_00,_71^IBIT);
-NODE _99 = NODE(in5,_71,_83);
-NODE _100 = NODE(in2,_84,_92^IBIT);
-NODE _101 = NODE(in2,_85,_93);
-NODE _102 = NODE(in2,_86,_94);
-NODE _103 = NODE(in2,_87,_95);
-NODE _104 = NODE(in2,_88,_96^IBIT);
-NODE _105 = NODE(in2,_89,_97);
-NODE _106 = NODE(in2,_90,_98^IBIT);
-NODE _107 = NODE(in2,_91,_99);
-NODE _108 = NODE(in3,_100,_104^IBIT);
-NODE _109 = NODE(in3,_101,_105^IBIT);
-NODE _110 = NODE(in3,_102,_106^IBIT);
-NODE _111 = NODE(in3,_103,_107);
-NODE _112 = NODE(in1,_108,_110);
-NODE _113 = NODE(in1,_109,_111^IBIT);
-NODE _114 = NODE(in6,_112,_113^IBIT);
-return _114;
-}
-NODE __attribute__((optimize("O0"))) SBOX2(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _12 = NODE(in4,in7,_02^IBIT);
-NODE _13 = NODE(in4,0,in7^IBIT);
-NODE _17 = NODE(in4,0,_03^IBIT);
-NODE _27 = NODE(in4,_00,_03);
-NODE _64 = NODE(in4,_04,in0^IBIT);
-NODE _66 = NODE(in4,_02,_01^IBIT);
-NODE _68 = NODE(in4,_00,in7^IBIT);
-NODE _70 = NODE(in4,_01,0);
-NODE _72 = NODE(in4,in0,_00);
-NODE _75 = NODE(in4,_03,_02^IBIT);
-NODE _115 = NODE(in4,_01,_02);
-NODE _116 = NODE(in4,in0,_03^IBIT);
-NODE _117 = NODE(in0,in4,0);
-NODE _118 = NODE(in4,_03,_00);
-NODE _119 = NODE(in4,_03,_04);
-NODE _120 = NODE(in4,in7,_00^IBIT);
-NODE _121 = NODE(in4,_04,_00^IBIT);
-NODE _122 = NODE(in4,_01,in7);
-NODE _123 = NODE(in4,_03,in7);
-NODE _124 = NODE(in4,0,_00^IBIT);
-NODE _125 = NODE(in4,_03,IBIT);
-NODE _126 = NODE(in4,0,in7);
-NODE _127 = NODE(in4,in0,_00^IBIT);
-NODE _128 = NODE(in4,_03,_00^IBIT);
-NODE _129 = NODE(in5,_115,_123^IBIT);
-NODE _130 = NODE(in5,_02,_124^IBIT);
-NODE _131 = NODE(in5,_116,_66^IBIT);
-NODE _132 = NODE(in5,_66,0);
-NODE _133 = NODE(in5,_27,in7^IBIT);
-NODE _134 = NODE(in5,_117,_125^IBIT);
-NODE _135 = NODE(in5,_118,_27);
-NODE _136 = NODE(in5,_119,_126^IBIT);
-NODE _137 = NODE(in5,_12,_127^IBIT);
-NODE _138 = NODE(in5,_64,_72);
-NODE _139 = NODE(in5,_12,_01^IBIT);
-NODE _140 = NODE(in5,_68,_13^IBIT);
-NODE _141 = NODE(in5,_117,_128^IBIT);
-NODE _142 = NODE(in5,_120,_75^IBIT);
-NODE _143 = NODE(in5,_121,_70);
-NODE _144 = NODE(in5,_122,_17^IBIT);
-NODE _145 = NODE(in2,_129,_137);
-NODE _146 = NODE(in2,_130,_138^IBIT);
-NODE _147 = NODE(in2,_131,_139^IBIT);
-NODE _148 = NODE(in2,_132,_140^IBIT);
-NODE _149 = NODE(in2,_133,_141^IBIT);
-NODE _150 = NODE(in2,_134,_142^IBIT);
-NODE _151 = NODE(in2,_135,_143^IBIT);
-NODE _152 = NODE(in2,_136,_144);
-NODE _153 = NODE(in3,_145,_149^IBIT);
-NODE _154 = NODE(in3,_146,_150);
-NODE _155 = NODE(in3,_147,_151^IBIT);
-NODE _156 = NODE(in3,_148,_152);
-NODE _157 = NODE(in1,_153,_155);
-NODE _158 = NODE(in1,_154,_156);
-NODE _159 = NODE(in6,_157,_158^IBIT);
-return _159;
-}
-NODE __attribute__((optimize("O0"))) SBOX3(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _06 = NODE(in4,_00,_04);
-NODE _08 = NODE(in4,_01,_00^IBIT);
-NODE _10 = NODE(in4,_02,_03);
-NODE _11 = NODE(in4,_02,0);
-NODE _16 = NODE(in4,_03,in0^IBIT);
-NODE _18 = NODE(in4,_04,_02);
-NODE _26 = NODE(in4,_01,_03);
-NODE _63 = NODE(in4,_04,IBIT);
-NODE _65 = NODE(in4,_02,_03^IBIT);
-NODE _73 = NODE(in4,in0,_02);
-NODE _80 = NODE(in4,in7,_01);
-NODE _82 = NODE(in4,_04,_01^IBIT);
-NODE _120 = NODE(in4,in7,_00^IBIT);
-NODE _122 = NODE(in4,_01,in7);
-NODE _124 = NODE(in4,0,_00^IBIT);
-NODE _160 = NODE(in4,_00,_02);
-NODE _161 = NODE(in4,_02,_00^IBIT);
-NODE _162 = NODE(in4,_02,_04);
-NODE _163 = NODE(in4,_00,in0);
-NODE _164 = NODE(in4,_01,_04);
-NODE _165 = NODE(in4,_04,0);
-NODE _166 = NODE(in4,_03,_01);
-NODE _167 = NODE(in4,_04,in0);
-NODE _168 = NODE(in4,in7,in0^IBIT);
-NODE _169 = NODE(in4,in0,_03);
-NODE _170 = NODE(in4,_02,_01);
-NODE _171 = NODE(in4,in7,_03);
-NODE _172 = NODE(in0,0,in4^IBIT);
-NODE _173 = NODE(in4,_01,_00);
-NODE _174 = NODE(in4,_03,_03^IBIT);
-NODE _175 = NODE(in5,_63,_124^IBIT);
-NODE _176 = NODE(in5,_80,_168);
-NODE _177 = NODE(in5,_160,_120);
-NODE _178 = NODE(in5,_161,_160);
-NODE _179 = NODE(in5,_162,_169);
-NODE _180 = NODE(in5,_16,_26^IBIT);
-NODE _181 = NODE(in5,_10,_170);
-NODE _182 = NODE(in5,_73,_18);
-NODE _183 = NODE(in5,_163,_82^IBIT);
-NODE _184 = NODE(in5,_164,_10^IBIT);
-NODE _185 = NODE(in5,_65,_171^IBIT);
-NODE _186 = NODE(in5,_165,_11);
-NODE _187 = NODE(in5,_166,_06);
-NODE _188 = NODE(in5,_122,_172^IBIT);
-NODE _189 = NODE(in5,_167,_173);
-NODE _190 = NODE(in5,_08,_174);
-NODE _191 = NODE(in2,_175,_183);
-NODE _192 = NODE(in2,_176,_184);
-NODE _193 = NODE(in2,_177,_185^IBIT);
-NODE _194 = NODE(in2,_178,_186);
-NODE _195 = NODE(in2,_179,_187^IBIT);
-NODE _196 = NODE(in2,_180,_188^IBIT);
-NODE _197 = NODE(in2,_181,_189^IBIT);
-NODE _198 = NODE(in2,_182,_190^IBIT);
-NODE _199 = NODE(in3,_191,_195);
-NODE _200 = NODE(in3,_192,_196^IBIT);
-NODE _201 = NODE(in3,_193,_197);
-NODE _202 = NODE(in3,_194,_198^IBIT);
-NODE _203 = NODE(in1,_199,_201^IBIT);
-NODE _204 = NODE(in1,_200,_202);
-NODE _205 = NODE(in6,_203,_204);
-return _205;
-}
-NODE __attribute__((optimize("O0"))) SBOX4(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _12 = NODE(in4,in7,_02^IBIT);
-NODE _13 = NODE(in4,0,in7^IBIT);
-NODE _17 = NODE(in4,0,_03^IBIT);
-NODE _22 = NODE(in4,_01,IBIT);
-NODE _60 = NODE(in4,0,_02^IBIT);
-NODE _62 = NODE(in4,_00,_04^IBIT);
-NODE _64 = NODE(in4,_04,in0^IBIT);
-NODE _65 = NODE(in4,_02,_03^IBIT);
-NODE _66 = NODE(in4,_02,_01^IBIT);
-NODE _73 = NODE(in4,in0,_02);
-NODE _76 = NODE(in4,_03,_02);
-NODE _77 = NODE(in4,_01,_04^IBIT);
-NODE _81 = NODE(in4,_01,in0);
-NODE _120 = NODE(in4,in7,_00^IBIT);
-NODE _121 = NODE(in4,_04,_00^IBIT);
-NODE _124 = NODE(in4,0,_00^IBIT);
-NODE _128 = NODE(in4,_03,_00^IBIT);
-NODE _163 = NODE(in4,_00,in0);
-NODE _206 = NODE(in4,in7,_04);
-NODE _207 = NODE(in4,0,_04);
-NODE _208 = NODE(in4,_00,_02^IBIT);
-NODE _209 = NODE(in4,_01,_01^IBIT);
-NODE _210 = NODE(in4,_04,in7);
-NODE _211 = NODE(in4,_04,_03);
-NODE _212 = NODE(in4,0,_04^IBIT);
-NODE _213 = NODE(in4,_00,0);
-NODE _214 = NODE(in4,0,_01);
-NODE _215 = NODE(in4,_00,_03^IBIT);
-NODE _216 = NODE(in4,in0,_01^IBIT);
-NODE _217 = NODE(in5,_60,_213^IBIT);
-NODE _218 = NODE(in5,_206,_65^IBIT);
-NODE _219 = NODE(in5,_207,_214^IBIT);
-NODE _220 = NODE(in5,_22,_62);
-NODE _221 = NODE(in5,_12,_81);
-NODE _222 = NODE(in5,_208,_66);
-NODE _223 = NODE(in5,_209,_163);
-NODE _224 = NODE(in5,_210,_120);
-NODE _225 = NODE(in5,_128,IBIT);
-NODE _226 = NODE(in5,_121,in7);
-NODE _227 = NODE(in5,_211,_77^IBIT);
-NODE _228 = NODE(in5,_73,_215^IBIT);
-NODE _229 = NODE(in5,_17,_121);
-NODE _230 = NODE(in5,_64,_216);
-NODE _231 = NODE(in5,_76,_13^IBIT);
-NODE _232 = NODE(in5,_212,_124);
-NODE _233 = NODE(in2,_217,_225^IBIT);
-NODE _234 = NODE(in2,_218,_226^IBIT);
-NODE _235 = NODE(in2,_219,_227);
-NODE _236 = NODE(in2,_220,_228);
-NODE _237 = NODE(in2,_221,_229^IBIT);
-NODE _238 = NODE(in2,_222,_230^IBIT);
-NODE _239 = NODE(in2,_223,_231^IBIT);
-NODE _240 = NODE(in2,_224,_232^IBIT);
-NODE _241 = NODE(in3,_233,_237);
-NODE _242 = NODE(in3,_234,_238);
-NODE _243 = NODE(in3,_235,_239);
-NODE _244 = NODE(in3,_236,_240^IBIT);
-NODE _245 = NODE(in1,_241,_243);
-NODE _246 = NODE(in1,_242,_244^IBIT);
-NODE _247 = NODE(in6,_245,_246);
-return _247^IBIT;
-}
-NODE __attribute__((optimize("O0"))) SBOX5(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _06 = NODE(in4,_00,_04);
-NODE _08 = NODE(in4,_01,_00^IBIT);
-NODE _13 = NODE(in4,0,in7^IBIT);
-NODE _17 = NODE(in4,0,_03^IBIT);
-NODE _18 = NODE(in4,_04,_02);
-NODE _21 = NODE(in4,in7,_00);
-NODE _25 = NODE(in4,_03,_04^IBIT);
-NODE _29 = NODE(in4,_01,in0^IBIT);
-NODE _63 = NODE(in4,_04,IBIT);
-NODE _68 = NODE(in4,_00,in7^IBIT);
-NODE _69 = NODE(in4,_04,in7^IBIT);
-NODE _70 = NODE(in4,_01,0);
-NODE _73 = NODE(in4,in0,_02);
-NODE _116 = NODE(in4,in0,_03^IBIT);
-NODE _128 = NODE(in4,_03,_00^IBIT);
-NODE _163 = NODE(in4,_00,in0);
-NODE _168 = NODE(in4,in7,in0^IBIT);
-NODE _206 = NODE(in4,in7,_04);
-NODE _208 = NODE(in4,_00,_02^IBIT);
-NODE _212 = NODE(in4,0,_04^IBIT);
-NODE _215 = NODE(in4,_00,_03^IBIT);
-NODE _248 = NODE(in4,_02,_00);
-NODE _249 = NODE(in4,_04,_03^IBIT);
-NODE _250 = NODE(in4,_02,in0^IBIT);
-NODE _251 = NODE(in4,_03,0);
-NODE _252 = NODE(in4,0,_03);
-NODE _253 = NODE(in5,_73,_252^IBIT);
-NODE _254 = NODE(in5,_08,_25^IBIT);
-NODE _255 = NODE(in5,_248,_212^IBIT);
-NODE _256 = NODE(in5,_17,_163);
-NODE _257 = NODE(in5,_249,_73);
-NODE _258 = NODE(in5,_29,_215^IBIT);
-NODE _259 = NODE(in5,_206,_168^IBIT);
-NODE _260 = NODE(in5,_13,_68);
-NODE _261 = NODE(in5,_250,_18);
-NODE _262 = NODE(in5,_251,_70);
-NODE _263 = NODE(in5,_21,_208^IBIT);
-NODE _264 = NODE(in5,_69,_02);
-NODE _265 = NODE(in5,_13,_128^IBIT);
-NODE _266 = NODE(in5,_208,_06^IBIT);
-NODE _267 = NODE(in5,_116,in7);
-NODE _268 = NODE(in5,_63,_69);
-NODE _269 = NODE(in2,_253,_261);
-NODE _270 = NODE(in2,_254,_262);
-NODE _271 = NODE(in2,_255,_263);
-NODE _272 = NODE(in2,_256,_264^IBIT);
-NODE _273 = NODE(in2,_257,_265^IBIT);
-NODE _274 = NODE(in2,_258,_266);
-NODE _275 = NODE(in2,_259,_267);
-NODE _276 = NODE(in2,_260,_268);
-NODE _277 = NODE(in3,_269,_273);
-NODE _278 = NODE(in3,_270,_274^IBIT);
-NODE _279 = NODE(in3,_271,_275^IBIT);
-NODE _280 = NODE(in3,_272,_276^IBIT);
-NODE _281 = NODE(in1,_277,_279);
-NODE _282 = NODE(in1,_278,_280);
-NODE _283 = NODE(in6,_281,_282);
-return _283;
-}
-NODE __attribute__((optimize("O0"))) SBOX6(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _08 = NODE(in4,_01,_00^IBIT);
-NODE _14 = NODE(in4,in7,_01^IBIT);
-NODE _15 = NODE(in4,_03,in0);
-NODE _18 = NODE(in4,_04,_02);
-NODE _22 = NODE(in4,_01,IBIT);
-NODE _24 = NODE(in4,in7,IBIT);
-NODE _25 = NODE(in4,_03,_04^IBIT);
-NODE _64 = NODE(in4,_04,in0^IBIT);
-NODE _67 = NODE(in4,in0,_01);
-NODE _68 = NODE(in4,_00,in7^IBIT);
-NODE _69 = NODE(in4,_04,in7^IBIT);
-NODE _71 = NODE(in4,_02,_02^IBIT);
-NODE _72 = NODE(in4,in0,_00);
-NODE _76 = NODE(in4,_03,_02);
-NODE _80 = NODE(in4,in7,_01);
-NODE _117 = NODE(in0,in4,0);
-NODE _119 = NODE(in4,_03,_04);
-NODE _125 = NODE(in4,_03,IBIT);
-NODE _128 = NODE(in4,_03,_00^IBIT);
-NODE _164 = NODE(in4,_01,_04);
-NODE _172 = NODE(in0,0,in4^IBIT);
-NODE _207 = NODE(in4,0,_04);
-NODE _209 = NODE(in4,_01,_01^IBIT);
-NODE _248 = NODE(in4,_02,_00);
-NODE _284 = NODE(in4,_04,_04^IBIT);
-NODE _285 = NODE(in5,_14,_24);
-NODE _286 = NODE(in5,_68,_64);
-NODE _287 = NODE(in5,_72,_18^IBIT);
-NODE _288 = NODE(in5,_68,_24);
-NODE _289 = NODE(in5,_125,_71);
-NODE _290 = NODE(in5,_284,_80^IBIT);
-NODE _291 = NODE(in5,_22,_248^IBIT);
-NODE _292 = NODE(in5,_164,_80^IBIT);
-NODE _293 = NODE(in5,_15,_64);
-NODE _294 = NODE(in5,_119,_172^IBIT);
-NODE _295 = NODE(in5,_69,_08^IBIT);
-NODE _296 = NODE(in5,in7,_25^IBIT);
-NODE _297 = NODE(in5,_128,_117);
-NODE _298 = NODE(in5,_117,_207^IBIT);
-NODE _299 = NODE(in5,_125,_209^IBIT);
-NODE _300 = NODE(in5,_76,_67);
-NODE _301 = NODE(in2,_285,_293^IBIT);
-NODE _302 = NODE(in2,_286,_294);
-NODE _303 = NODE(in2,_287,_295);
-NODE _304 = NODE(in2,_288,_296);
-NODE _305 = NODE(in2,_289,_297^IBIT);
-NODE _306 = NODE(in2,_290,_298);
-NODE _307 = NODE(in2,_291,_299);
-NODE _308 = NODE(in2,_292,_300^IBIT);
-NODE _309 = NODE(in3,_301,_305);
-NODE _310 = NODE(in3,_302,_306^IBIT);
-NODE _311 = NODE(in3,_303,_307);
-NODE _312 = NODE(in3,_304,_308);
-NODE _313 = NODE(in1,_309,_311^IBIT);
-NODE _314 = NODE(in1,_310,_312^IBIT);
-NODE _315 = NODE(in6,_313,_314);
-return _315;
-}
-NODE __attribute__((optimize("O0"))) SBOX7(NODE in7, NODE in6, NODE in5, NODE in4, NODE in3, NODE in2, NODE in1, NODE in0) {
-NODE _00 = NODE(in0,in7,IBIT);
-NODE _01 = NODE(in0,in7,0);
-NODE _02 = NODE(in0,in7,in7^IBIT);
-NODE _03 = NODE(in0,0,in7^IBIT);
-NODE _04 = NODE(in0,0,in7);
-NODE _07 = NODE(in4,_00,_01^IBIT);
-NODE _17 = NODE(in4,0,_03^IBIT);
-NODE _18 = NODE(in4,_04,_02);
-NODE _22 = NODE(in4,_01,IBIT);
-NODE _27 = NODE(in4,_00,_03);
-NODE _28 = NODE(in4,_02,_04^IBIT);
-NODE _68 = NODE(in4,_00,in7^IBIT);
-NODE _69 = NODE(in4,_04,in7^IBIT);
-NODE _76 = NODE(in4,_03,_02);
-NODE _116 = NODE(in4,in0,_03^IBIT);
-NODE _118 = NODE(in4,_03,_00);
-NODE _122 = NODE(in4,_01,in7);
-NODE _123 = NODE(in4,_03,in7);
-NODE _125 = NODE(in4,_03,IBIT);
-NODE _160 = NODE(in4,_00,_02);
-NODE _164 = NODE(in4,_01,_04);
-NODE _166 = NODE(in4,_03,_01);
-NODE _169 = NODE(in4,in0,_03);
-NODE _170 = NODE(in4,_02,_01);
-NODE _174 = NODE(in4,_03,_03^IBIT);
-NODE _214 = NODE(in4,0,_01);
-NODE _215 = NODE(in4,_00,_03^IBIT);
-NODE _251 = NODE(in4,_03,0);
-NODE _284 = NODE(in4,_04,_04^IBIT);
-NODE _316 = NODE(in4,in0,_04^IBIT);
-NODE _317 = NODE(in4,in0,in7^IBIT);
-NODE _318 = NODE(in4,0,_01^IBIT);
-NODE _319 = NODE(in4,in7,in0);
-NODE _320 = NODE(in4,_02,in7^IBIT);
-NODE _321 = NODE(in4,_02,IBIT);
-NODE _322 = NODE(in5,_164,_116^IBIT);
-NODE _323 = NODE(in5,_316,_169^IBIT);
-NODE _324 = NODE(in5,_28,_319^IBIT);
-NODE _325 = NODE(in5,_174,_122^IBIT);
-NODE _326 = NODE(in5,_27,_169);
-NODE _327 = NODE(in5,_317,_118^IBIT);
-NODE _328 = NODE(in5,_318,_07);
-NODE _329 = NODE(in5,_125,_76^IBIT);
-NODE _330 = NODE(in5,_123,_320);
-NODE _331 = NODE(in5,_214,_22);
-NODE _332 = NODE(in5,_18,_68);
-NODE _333 = NODE(in5,_17,_69^IBIT);
-NODE _334 = NODE(in5,_170,_321);
-NODE _335 = NODE(in5,_215,_170^IBIT);
-NODE _336 = NODE(in5,_251,_160);
-NODE _337 = NODE(in5,_166,_284);
-NODE _338 = NODE(in2,_322,_330^IBIT);
-NODE _339 = NODE(in2,_323,_331);
-NODE _340 = NODE(in2,_324,_332);
-NODE _341 = NODE(in2,_325,_333);
-NODE _342 = NODE(in2,_326,_334);
-NODE _343 = NODE(in2,_327,_335^IBIT);
-NODE _344 = NODE(in2,_328,_336);
-NODE _345 = NODE(in2,_329,_337);
-NODE _346 = NODE(in3,_338,_342);
-NODE _347 = NODE(in3,_339,_343^IBIT);
-NODE _348 = NODE(in3,_340,_344);
-NODE _349 = NODE(in3,_341,_345^IBIT);
-NODE _350 = NODE(in1,_346,_348);
-NODE _351 = NODE(in1,_347,_349^IBIT);
-NODE _352 = NODE(in6,_350,_351);
-return _352^IBIT;
-}
+/*
+ * buildaesbox.h
+ * 	Gate lists of the bit-sliced AES S-boxes, one box per output bit.
+ * 	`aesZBoxes[]` are used by the rounds (`zbox`), `aesSBoxes[]` by the key schedule.
+ * 	Box inputs are the 8 bits of a byte, `CIRCUIT_IN(0)` being the least significant.
+ */
+
+static const circuitGate_t aesZGates0[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), 0},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(6), CIRCUIT_GATE(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(9), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(12), CIRCUIT_GATE(13) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(15), CIRCUIT_GATE(16)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(18), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(15), CIRCUIT_GATE(21) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(23), CIRCUIT_GATE(24)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), 0},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(26), CIRCUIT_GATE(27)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(29), CIRCUIT_GATE(30) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(32), CIRCUIT_GATE(33)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(26), CIRCUIT_GATE(35)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(37), CIRCUIT_GATE(38)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(40), CIRCUIT_GATE(41)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(43), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(35), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(5), CIRCUIT_GATE(28)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(8), CIRCUIT_GATE(31) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(11), CIRCUIT_GATE(34)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(14), CIRCUIT_GATE(36)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(17), CIRCUIT_GATE(39) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(20), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(22), CIRCUIT_GATE(44) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(25), CIRCUIT_GATE(46)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(47), CIRCUIT_GATE(51)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(48), CIRCUIT_GATE(52)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(49), CIRCUIT_GATE(53) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(50), CIRCUIT_GATE(54)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(55), CIRCUIT_GATE(57)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(56), CIRCUIT_GATE(58) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(59), CIRCUIT_GATE(60) | CIRCUIT_INV},
+};
+static const circuitGate_t aesZGates1[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(2), CIRCUIT_GATE(11) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(13), CIRCUIT_GATE(14) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(2), CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(11), CIRCUIT_GATE(16) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(18), CIRCUIT_GATE(8) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(7), CIRCUIT_GATE(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), 0},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(21), CIRCUIT_GATE(22) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(24), CIRCUIT_GATE(25) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(6), CIRCUIT_GATE(27)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(3), CIRCUIT_GATE(29)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), 0},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(31), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(33), CIRCUIT_GATE(34)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(36), CIRCUIT_GATE(37)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(39), CIRCUIT_GATE(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(9), CIRCUIT_GATE(5)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(42), CIRCUIT_GATE(43) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(45), CIRCUIT_GATE(39) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(12), CIRCUIT_GATE(30)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(15), CIRCUIT_GATE(32)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(17), CIRCUIT_GATE(35)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(19), CIRCUIT_GATE(38) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(20), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(23), CIRCUIT_GATE(41) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(26), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(28), CIRCUIT_GATE(46)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(47), CIRCUIT_GATE(51) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(48), CIRCUIT_GATE(52)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(49), CIRCUIT_GATE(53) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(50), CIRCUIT_GATE(54) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(55), CIRCUIT_GATE(57) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(56), CIRCUIT_GATE(58)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(59), CIRCUIT_GATE(60)},
+};
+static const circuitGate_t aesZGates2[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(15), CIRCUIT_GATE(16)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(5), CIRCUIT_GATE(18)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(20), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(9), CIRCUIT_GATE(22)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(14), CIRCUIT_GATE(24)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(26), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(28), CIRCUIT_GATE(29)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(31), CIRCUIT_GATE(32) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(13), CIRCUIT_GATE(11)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(6), CIRCUIT_GATE(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(8), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(37), CIRCUIT_GATE(38)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(10), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(0), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(11), CIRCUIT_GATE(44) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(46), CIRCUIT_GATE(47)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(17), CIRCUIT_GATE(34)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(19), CIRCUIT_GATE(35)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(21), CIRCUIT_GATE(36) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(23), CIRCUIT_GATE(39) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(25), CIRCUIT_GATE(41)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(27), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(30), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(33), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(49), CIRCUIT_GATE(53)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(50), CIRCUIT_GATE(54)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(51), CIRCUIT_GATE(55) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(52), CIRCUIT_GATE(56)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(57), CIRCUIT_GATE(59) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(58), CIRCUIT_GATE(60) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(61), CIRCUIT_GATE(62)},
+};
+static const circuitGate_t aesZGates3[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), 0},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), 0},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(16), CIRCUIT_GATE(22) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(10), CIRCUIT_GATE(6) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(12), CIRCUIT_GATE(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(26), CIRCUIT_GATE(19)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(11), CIRCUIT_GATE(17)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(29), CIRCUIT_GATE(30) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(15), CIRCUIT_GATE(20)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(33), CIRCUIT_GATE(14)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(35), CIRCUIT_GATE(36) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(5), CIRCUIT_GATE(18)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(8), CIRCUIT_GATE(39) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(2), 0},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(41), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(44), CIRCUIT_GATE(21)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(21), CIRCUIT_GATE(9)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(13), CIRCUIT_IN(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(1), CIRCUIT_IN(0), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(23), CIRCUIT_GATE(37) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(24), CIRCUIT_GATE(38) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(25), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(27), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(28), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(31), CIRCUIT_GATE(46) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(32), CIRCUIT_GATE(47)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(34), CIRCUIT_GATE(49)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(50), CIRCUIT_GATE(54) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(51), CIRCUIT_GATE(55) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(52), CIRCUIT_GATE(56)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(53), CIRCUIT_GATE(57) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(58), CIRCUIT_GATE(60)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(59), CIRCUIT_GATE(61) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(62), CIRCUIT_GATE(63) | CIRCUIT_INV},
+};
+static const circuitGate_t aesZGates4[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), 0},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), 0},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(2)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(21), CIRCUIT_GATE(27) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(11), CIRCUIT_GATE(9)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(10), CIRCUIT_GATE(20) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(16), CIRCUIT_GATE(17) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(5), CIRCUIT_GATE(32)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(14), CIRCUIT_IN(2)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(2), CIRCUIT_IN(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(35), CIRCUIT_GATE(36)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(24), CIRCUIT_GATE(38) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(26), CIRCUIT_GATE(40)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(13), CIRCUIT_GATE(19)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(43), CIRCUIT_GATE(6)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(3), CIRCUIT_GATE(8) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(7), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(15), CIRCUIT_GATE(22)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(23), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(25), CIRCUIT_GATE(18)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(28), CIRCUIT_GATE(41) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(29), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(30), CIRCUIT_GATE(44) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(31), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(33), CIRCUIT_GATE(46) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(34), CIRCUIT_GATE(47)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(37), CIRCUIT_GATE(49)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(39), CIRCUIT_GATE(50) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(51), CIRCUIT_GATE(55) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(52), CIRCUIT_GATE(56) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(53), CIRCUIT_GATE(57) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(54), CIRCUIT_GATE(58) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(59), CIRCUIT_GATE(61) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(60), CIRCUIT_GATE(62)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(63), CIRCUIT_GATE(64) | CIRCUIT_INV},
+};
+static const circuitGate_t aesZGates5[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), 0},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(2)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(19), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(22), CIRCUIT_GATE(23)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(13), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(14), CIRCUIT_GATE(15)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(1), CIRCUIT_IN(2), CIRCUIT_GATE(27)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(15), CIRCUIT_GATE(10) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(11), CIRCUIT_GATE(30)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(17), CIRCUIT_GATE(16) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(5), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(4), CIRCUIT_GATE(20) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(35), CIRCUIT_GATE(18) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(8), CIRCUIT_GATE(7)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), 0},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(38), CIRCUIT_GATE(23)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(30), CIRCUIT_GATE(9) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(35), CIRCUIT_GATE(6) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(30), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(21), CIRCUIT_GATE(33) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(24), CIRCUIT_GATE(34) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(25), CIRCUIT_GATE(36)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(26), CIRCUIT_GATE(37)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(28), CIRCUIT_GATE(39) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(29), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(31), CIRCUIT_GATE(41) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(32), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(43), CIRCUIT_GATE(47) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(44), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(45), CIRCUIT_GATE(49) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(46), CIRCUIT_GATE(50) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(51), CIRCUIT_GATE(53)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(52), CIRCUIT_GATE(54)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(55), CIRCUIT_GATE(56) | CIRCUIT_INV},
+};
+static const circuitGate_t aesZGates6[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(6), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), 0, CIRCUIT_GATE(15)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(26), CIRCUIT_GATE(27) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(11), CIRCUIT_GATE(20)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(12), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(31), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(21), CIRCUIT_GATE(22) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(6), CIRCUIT_GATE(17) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(22), CIRCUIT_GATE(35)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(37), CIRCUIT_GATE(7)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(23), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(8), CIRCUIT_GATE(13) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(18), CIRCUIT_GATE(14)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(9), CIRCUIT_GATE(42)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(15), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(16), CIRCUIT_GATE(5)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(24), CIRCUIT_GATE(36)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(25), CIRCUIT_GATE(38) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(28), CIRCUIT_GATE(39)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(29), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(30), CIRCUIT_GATE(41) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(32), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(33), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(34), CIRCUIT_GATE(46)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(47), CIRCUIT_GATE(51)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(48), CIRCUIT_GATE(52) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(49), CIRCUIT_GATE(53)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(50), CIRCUIT_GATE(54) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(55), CIRCUIT_GATE(57)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(56), CIRCUIT_GATE(58)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(59), CIRCUIT_GATE(60)},
+};
+static const circuitGate_t aesZGates7[] = {
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), 0},
+	{CIRCUIT_IN(2), CIRCUIT_IN(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), 0},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(1), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), 0, CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(2), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(2), CIRCUIT_IN(7), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(8), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(20), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(23), CIRCUIT_GATE(22) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(25), CIRCUIT_GATE(29) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(3), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(11), CIRCUIT_GATE(34) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(25), CIRCUIT_GATE(26)},
+	{CIRCUIT_IN(1), 0, CIRCUIT_GATE(6) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(38), CIRCUIT_GATE(18)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(17), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(4), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(10), CIRCUIT_GATE(41) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(28), CIRCUIT_GATE(21)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(7), CIRCUIT_GATE(15) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(13), CIRCUIT_GATE(9) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(16), CIRCUIT_GATE(24) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(14), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(27), CIRCUIT_GATE(5)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(30), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(31), CIRCUIT_GATE(42)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(32), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(33), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(35), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(36), CIRCUIT_GATE(46) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(37), CIRCUIT_GATE(47)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(39), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(49), CIRCUIT_GATE(53) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(50), CIRCUIT_GATE(54)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(51), CIRCUIT_GATE(55) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(52), CIRCUIT_GATE(56) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(57), CIRCUIT_GATE(59) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(58), CIRCUIT_GATE(60) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(61), CIRCUIT_GATE(62) | CIRCUIT_INV},
+};
+static const circuitGate_t aesSGates0[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), 0},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(4), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(5), CIRCUIT_GATE(20)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(6), CIRCUIT_GATE(21) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(22) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(8), CIRCUIT_GATE(23)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(9), CIRCUIT_GATE(24)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(10), CIRCUIT_GATE(25)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(11), CIRCUIT_GATE(26) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(12), CIRCUIT_GATE(27) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(3), CIRCUIT_GATE(16)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(13), CIRCUIT_GATE(6) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(14), CIRCUIT_GATE(16) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(16), CIRCUIT_GATE(28)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(17), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(18), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(19), CIRCUIT_GATE(29) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(30), CIRCUIT_GATE(38)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(31), CIRCUIT_GATE(39) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(32), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(33), CIRCUIT_GATE(15) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(34), CIRCUIT_GATE(41)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(37), CIRCUIT_GATE(44) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(45), CIRCUIT_GATE(49)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(46), CIRCUIT_GATE(50) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(47), CIRCUIT_GATE(51)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(48), CIRCUIT_GATE(52) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(53), CIRCUIT_GATE(55)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(54), CIRCUIT_GATE(56)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(57), CIRCUIT_GATE(58)},
+};
+static const circuitGate_t aesSGates1[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), 0},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(8), CIRCUIT_GATE(20) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(9), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(10), CIRCUIT_GATE(21)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(11), CIRCUIT_GATE(22) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(12), CIRCUIT_GATE(23) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(13), CIRCUIT_GATE(24) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(25)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(5), CIRCUIT_GATE(26) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(14), CIRCUIT_GATE(27) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(15), CIRCUIT_GATE(28) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(16), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(17), CIRCUIT_GATE(28) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(6), CIRCUIT_GATE(29) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(18), CIRCUIT_GATE(30) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(0), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(19), CIRCUIT_GATE(31)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(32), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(33), CIRCUIT_GATE(41)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(34), CIRCUIT_GATE(42)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(44) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(37), CIRCUIT_GATE(45)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(38), CIRCUIT_GATE(46) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(39), CIRCUIT_GATE(47)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(48), CIRCUIT_GATE(52) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(49), CIRCUIT_GATE(53) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(50), CIRCUIT_GATE(54) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(51), CIRCUIT_GATE(55)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(56), CIRCUIT_GATE(58)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(57), CIRCUIT_GATE(59) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(60), CIRCUIT_GATE(61) | CIRCUIT_INV},
+};
+static const circuitGate_t aesSGates2[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), 0},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(4), 0},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(15), CIRCUIT_GATE(23) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(2), CIRCUIT_GATE(24) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(16), CIRCUIT_GATE(10) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(10), 0},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(8), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(17), CIRCUIT_GATE(25) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(18), CIRCUIT_GATE(8)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(19), CIRCUIT_GATE(26) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(5), CIRCUIT_GATE(27) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(9), CIRCUIT_GATE(13)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(5), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(11), CIRCUIT_GATE(6) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(17), CIRCUIT_GATE(28) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(20), CIRCUIT_GATE(14) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(21), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(22), CIRCUIT_GATE(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(29), CIRCUIT_GATE(37)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(30), CIRCUIT_GATE(38) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(31), CIRCUIT_GATE(39) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(32), CIRCUIT_GATE(40) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(33), CIRCUIT_GATE(41) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(34), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(43) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(45), CIRCUIT_GATE(49) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(46), CIRCUIT_GATE(50)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(47), CIRCUIT_GATE(51) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(48), CIRCUIT_GATE(52)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(53), CIRCUIT_GATE(55)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(54), CIRCUIT_GATE(56)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(57), CIRCUIT_GATE(58) | CIRCUIT_INV},
+};
+static const circuitGate_t aesSGates3[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), 0},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), 0},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(12), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(15), CIRCUIT_GATE(28)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(20), CIRCUIT_GATE(17)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(21), CIRCUIT_GATE(20)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(22), CIRCUIT_GATE(29)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(9), CIRCUIT_GATE(11) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(30)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(14), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(23), CIRCUIT_GATE(16) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(24), CIRCUIT_GATE(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(13), CIRCUIT_GATE(31) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(25), CIRCUIT_GATE(8)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(26), CIRCUIT_GATE(5)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(18), CIRCUIT_GATE(32) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(27), CIRCUIT_GATE(33)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(6), CIRCUIT_GATE(34)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(37), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(38), CIRCUIT_GATE(46)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(39), CIRCUIT_GATE(47) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(40), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(41), CIRCUIT_GATE(49) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(42), CIRCUIT_GATE(50) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(51), CIRCUIT_GATE(55)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(52), CIRCUIT_GATE(56) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(53), CIRCUIT_GATE(57)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(54), CIRCUIT_GATE(58) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(59), CIRCUIT_GATE(61) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(60), CIRCUIT_GATE(62)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(63), CIRCUIT_GATE(64)},
+};
+static const circuitGate_t aesSGates4[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), 0},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(9), CIRCUIT_GATE(30) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(23), CIRCUIT_GATE(12) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(24), CIRCUIT_GATE(31) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(8), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(5), CIRCUIT_GATE(17)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(25), CIRCUIT_GATE(13)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(26), CIRCUIT_GATE(22)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(27), CIRCUIT_GATE(18)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(21), CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(19), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(28), CIRCUIT_GATE(16) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(14), CIRCUIT_GATE(32) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(19)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(11), CIRCUIT_GATE(33)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(15), CIRCUIT_GATE(6) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(29), CIRCUIT_GATE(20)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(34), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(43) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(37), CIRCUIT_GATE(45)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(38), CIRCUIT_GATE(46) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(39), CIRCUIT_GATE(47) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(40), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(41), CIRCUIT_GATE(49) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(50), CIRCUIT_GATE(54)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(51), CIRCUIT_GATE(55)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(52), CIRCUIT_GATE(56)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(53), CIRCUIT_GATE(57) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(58), CIRCUIT_GATE(60)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(59), CIRCUIT_GATE(61) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(62), CIRCUIT_GATE(63)},
+};
+static const circuitGate_t aesSGates5[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), 0},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), 0},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(17), CIRCUIT_GATE(30) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(6), CIRCUIT_GATE(11) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(26), CIRCUIT_GATE(24) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(8), CIRCUIT_GATE(20)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(27), CIRCUIT_GATE(17)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(12), CIRCUIT_GATE(25) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(22), CIRCUIT_GATE(21) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(14)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(28), CIRCUIT_GATE(9)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(29), CIRCUIT_GATE(16)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(10), CIRCUIT_GATE(23) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(15), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(23), CIRCUIT_GATE(5) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(18), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(13), CIRCUIT_GATE(15)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(31), CIRCUIT_GATE(39)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(32), CIRCUIT_GATE(40)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(33), CIRCUIT_GATE(41)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(34), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(43) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(37), CIRCUIT_GATE(45)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(38), CIRCUIT_GATE(46)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(47), CIRCUIT_GATE(51)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(48), CIRCUIT_GATE(52) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(49), CIRCUIT_GATE(53) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(50), CIRCUIT_GATE(54) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(55), CIRCUIT_GATE(57)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(56), CIRCUIT_GATE(58)},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(59), CIRCUIT_GATE(60)},
+};
+static const circuitGate_t aesSGates6[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(2) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(0), CIRCUIT_IN(4), 0},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(0) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(6), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(14), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(17), CIRCUIT_GATE(8) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(14), CIRCUIT_GATE(10)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(22), CIRCUIT_GATE(16)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(29), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(9), CIRCUIT_GATE(28) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(24), CIRCUIT_GATE(19) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(12)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(21), CIRCUIT_GATE(25) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(15), CIRCUIT_GATE(5) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_IN(7), CIRCUIT_GATE(11) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(23), CIRCUIT_GATE(20)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(20), CIRCUIT_GATE(26) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(22), CIRCUIT_GATE(27) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(18), CIRCUIT_GATE(13)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(30), CIRCUIT_GATE(38) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(31), CIRCUIT_GATE(39)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(32), CIRCUIT_GATE(40)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(33), CIRCUIT_GATE(41)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(34), CIRCUIT_GATE(42) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(43)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(37), CIRCUIT_GATE(45) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(46), CIRCUIT_GATE(50)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(47), CIRCUIT_GATE(51) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(48), CIRCUIT_GATE(52)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(49), CIRCUIT_GATE(53)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(54), CIRCUIT_GATE(56) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(55), CIRCUIT_GATE(57) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(58), CIRCUIT_GATE(59)},
+};
+static const circuitGate_t aesSGates7[] = {
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_INV},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), 0},
+	{CIRCUIT_IN(0), CIRCUIT_IN(7), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(0), 0, CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_IN(7)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(2)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(1), CIRCUIT_GATE(4)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(3)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(1)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(0), CIRCUIT_GATE(3) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(3), 0},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(4), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_GATE(4) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(0), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), 0, CIRCUIT_GATE(1) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_IN(7), CIRCUIT_IN(0)},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_IN(7) | CIRCUIT_INV},
+	{CIRCUIT_IN(4), CIRCUIT_GATE(2), CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(20), CIRCUIT_GATE(14) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(29), CIRCUIT_GATE(22) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(10), CIRCUIT_GATE(32) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(24), CIRCUIT_GATE(16) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(9), CIRCUIT_GATE(22)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(30), CIRCUIT_GATE(15) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(31), CIRCUIT_GATE(5)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(18), CIRCUIT_GATE(13) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(17), CIRCUIT_GATE(33)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(25), CIRCUIT_GATE(8)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(7), CIRCUIT_GATE(11)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(6), CIRCUIT_GATE(12) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(23), CIRCUIT_GATE(34)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(26), CIRCUIT_GATE(23) | CIRCUIT_INV},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(27), CIRCUIT_GATE(19)},
+	{CIRCUIT_IN(5), CIRCUIT_GATE(21), CIRCUIT_GATE(28)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(35), CIRCUIT_GATE(43) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(36), CIRCUIT_GATE(44)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(37), CIRCUIT_GATE(45)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(38), CIRCUIT_GATE(46)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(39), CIRCUIT_GATE(47)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(40), CIRCUIT_GATE(48) | CIRCUIT_INV},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(41), CIRCUIT_GATE(49)},
+	{CIRCUIT_IN(2), CIRCUIT_GATE(42), CIRCUIT_GATE(50)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(51), CIRCUIT_GATE(55)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(52), CIRCUIT_GATE(56) | CIRCUIT_INV},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(53), CIRCUIT_GATE(57)},
+	{CIRCUIT_IN(3), CIRCUIT_GATE(54), CIRCUIT_GATE(58) | CIRCUIT_INV},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(59), CIRCUIT_GATE(61)},
+	{CIRCUIT_IN(1), CIRCUIT_GATE(60), CIRCUIT_GATE(62) | CIRCUIT_INV},
+	{CIRCUIT_IN(6), CIRCUIT_GATE(63), CIRCUIT_GATE(64)},
+};
+
+static const circuitBox_t aesZBoxes[] = {
+	{8, 62, aesZGates0, CIRCUIT_GATE(61) | CIRCUIT_INV},
+	{8, 62, aesZGates1, CIRCUIT_GATE(61) | CIRCUIT_INV},
+	{8, 64, aesZGates2, CIRCUIT_GATE(63)},
+	{8, 65, aesZGates3, CIRCUIT_GATE(64)},
+	{8, 66, aesZGates4, CIRCUIT_GATE(65)},
+	{8, 58, aesZGates5, CIRCUIT_GATE(57)},
+	{8, 62, aesZGates6, CIRCUIT_GATE(61)},
+	{8, 64, aesZGates7, CIRCUIT_GATE(63) | CIRCUIT_INV},
+};
+
+static const circuitBox_t aesSBoxes[] = {
+	{8, 60, aesSGates0, CIRCUIT_GATE(59)},
+	{8, 63, aesSGates1, CIRCUIT_GATE(62)},
+	{8, 60, aesSGates2, CIRCUIT_GATE(59)},
+	{8, 66, aesSGates3, CIRCUIT_GATE(65)},
+	{8, 65, aesSGates4, CIRCUIT_GATE(64) | CIRCUIT_INV},
+	{8, 62, aesSGates5, CIRCUIT_GATE(61)},
+	{8, 61, aesSGates6, CIRCUIT_GATE(60)},
+	{8, 66, aesSGates7, CIRCUIT_GATE(65) | CIRCUIT_INV},
+};
@@ -0,0 +1,249 @@
+/*
+ * buildaesstep.h
+ * 	Byte-wide steps of the AES key schedule and rounds, in order of evaluation.
+ * 	Operands are the `V[]` index of bit 0 of a byte, unused operands are `kZero`.
+ */
+
+struct aesStep_t {
+	uint16_t dst;    // output byte
+	uint16_t src[4]; // S-box input, or the MixColumns operands multiplied by 3, 2, 1 and 1
+	uint16_t key[4]; // bytes to add
+	uint8_t  rcon;   // constant to add
+};
+
+/*
+ * Bits of the MixColumns operands `src[]` contributing to bit `i` of the `zbox` input
+ */
+static const uint8_t aesMixColumns[8][4] = {
+	{0x09, 0xf8, 0xf1, 0xf1},
+	{0xea, 0x09, 0xe3, 0xe3},
+	{0x24, 0xe3, 0xc7, 0xc7},
+	{0xb0, 0x3f, 0x8f, 0x8f},
+	{0x68, 0x77, 0x1f, 0x1f},
+	{0x21, 0x1f, 0x3e, 0x3e},
+	{0x42, 0x3e, 0x7c, 0x7c},
+	{0x84, 0x7c, 0xf8, 0xf8},
+};
+
+/*
+ * Bits of the last `zbox` output contributing to output bit `i`
+ */
+static const uint8_t aesLastRound[8] = {0xf1, 0xe3, 0xc7, 0x8f, 0x1f, 0x3e, 0x7c, 0xf8};
+
+/*
+ * Key schedule, `dst = sbox[src] ^ key[] ^ rcon`
+ */
+static const aesStep_t aesKeySchedule[] = {
+	{k0700, {k310}, {k300, k100, k200, k000}, 0x62},
+	{k1130, {k0700}, {k330, k130}, 0x63},
+	{k1520, {k1130}, {k320, k220}, 0x63},
+	{k1910, {k1520}, {k310}, 0x63},
+	{k2300, {k1910}, {k0700}, 0x73},
+	{k2730, {k2300}, {k1130}, 0x63},
+	{k3120, {k2730}, {k1520}, 0x63},
+	{k3510, {k3120}, {k1910}, 0x63},
+	{k3900, {k3510}, {k2300}, 0x78},
+	{k4330, {k3900}, {k2730}, 0x63},
+	{k0730, {k300}, {k330, k130, k230, k030}, 0x63},
+	{k1120, {k0730}, {k320, k120}, 0x63},
+	{k1510, {k1120}, {k310, k210}, 0x63},
+	{k1900, {k1510}, {k300}, 0x6b},
+	{k2330, {k1900}, {k0730}, 0x63},
+	{k2720, {k2330}, {k1120}, 0x63},
+	{k3110, {k2720}, {k1510}, 0x63},
+	{k3500, {k3110}, {k1900}, 0xe3},
+	{k3930, {k3500}, {k2330}, 0x63},
+	{k4320, {k3930}, {k2720}, 0x63},
+	{k0720, {k330}, {k320, k120, k220, k020}, 0x63},
+	{k1110, {k0720}, {k310, k110}, 0x63},
+	{k1500, {k1110}, {k300, k200}, 0x67},
+	{k1930, {k1500}, {k330}, 0x63},
+	{k2320, {k1930}, {k0720}, 0x63},
+	{k2710, {k2320}, {k1110}, 0x63},
+	{k3100, {k2710}, {k1500}, 0x23},
+	{k3530, {k3100}, {k1930}, 0x63},
+	{k3920, {k3530}, {k2320}, 0x63},
+	{k4310, {k3920}, {k2710}, 0x63},
+	{k0710, {k320}, {k310, k110, k210, k010}, 0x63},
+	{k1100, {k0710}, {k300, k100}, 0x61},
+	{k1530, {k1100}, {k330, k230}, 0x63},
+	{k1920, {k1530}, {k320}, 0x63},
+	{k2310, {k1920}, {k0710}, 0x63},
+	{k2700, {k2310}, {k1100}, 0x43},
+	{k3130, {k2700}, {k1530}, 0x63},
+	{k3520, {k3130}, {k1920}, 0x63},
+	{k3910, {k3520}, {k2310}, 0x63},
+	{k4300, {k3910}, {k2700}, 0x55},
+};
+
+/*
+ * Rounds 1-9, `dst = zbox[mul3(src[0]) ^ mul2(src[1]) ^ src[2] ^ src[3] ^ key[] ^ rcon]`
+ */
+static const aesStep_t aesRounds[] = {
+	{v1000, {v0110, v0000, v0220, v0330}, {k0700, k300, k200, k100}, 0x63},
+	{v1100, {v0220, v0110, v0000, v0330}, {k0710, k310, k210, k110}, 0x63},
+	{v1200, {v0330, v0220, v0000, v0110}, {k0720, k320, k220, k120}, 0x63},
+	{v1300, {v0000, v0330, v0110, v0220}, {k0730, k330, k230, k130}, 0x63},
+	{v1010, {v0120, v0010, v0230, v0300}, {k0700, k300, k200}, 0x63},
+	{v1110, {v0230, v0120, v0010, v0300}, {k0710, k310, k210}, 0x63},
+	{v1210, {v0300, v0230, v0010, v0120}, {k0720, k320, k220}, 0x63},
+	{v1310, {v0010, v0300, v0120, v0230}, {k0730, k330, k230}, 0x63},
+	{v1020, {v0130, v0020, v0200, v0310}, {k0700, k300}, 0x63},
+	{v1120, {v0200, v0130, v0020, v0310}, {k0710, k310}, 0x63},
+	{v1220, {v0310, v0200, v0020, v0130}, {k0720, k320}, 0x63},
+	{v1320, {v0020, v0310, v0130, v0200}, {k0730, k330}, 0x63},
+	{v1030, {v0100, v0030, v0210, v0320}, {k0700}, 0x63},
+	{v1130, {v0210, v0100, v0030, v0320}, {k0710}, 0x63},
+	{v1230, {v0320, v0210, v0030, v0100}, {k0720}, 0x63},
+	{v1330, {v0030, v0320, v0100, v0210}, {k0730}, 0x63},
+	{v2000, {v1110, v1000, v1220, v1330}, {k1100, k0700, k200}, 0x63},
+	{v2100, {v1220, v1110, v1000, v1330}, {k1110, k0710, k210}, 0x63},
+	{v2200, {v1330, v1220, v1000, v1110}, {k1120, k0720, k220}, 0x63},
+	{v2300, {v1000, v1330, v1110, v1220}, {k1130, k0730, k230}, 0x63},
+	{v2010, {v1120, v1010, v1230, v1300}, {k1100, k300}, 0x63},
+	{v2110, {v1230, v1120, v1010, v1300}, {k1110, k310}, 0x63},
+	{v2210, {v1300, v1230, v1010, v1120}, {k1120, k320}, 0x63},
+	{v2310, {v1010, v1300, v1120, v1230}, {k1130, k330}, 0x63},
+	{v2020, {v1130, v1020, v1200, v1310}, {k1100, k0700}, 0x63},
+	{v2120, {v1200, v1130, v1020, v1310}, {k1110, k0710}, 0x63},
+	{v2220, {v1310, v1200, v1020, v1130}, {k1120, k0720}, 0x63},
+	{v2320, {v1020, v1310, v1130, v1200}, {k1130, k0730}, 0x63},
+	{v2030, {v1100, v1030, v1210, v1320}, {k1100}, 0x63},
+	{v2130, {v1210, v1100, v1030, v1320}, {k1110}, 0x63},
+	{v2230, {v1320, v1210, v1030, v1100}, {k1120}, 0x63},
+	{v2330, {v1030, v1320, v1100, v1210}, {k1130}, 0x63},
+	{v3000, {v2110, v2000, v2220, v2330}, {k1500, k1100, k0700, k300}, 0x63},
+	{v3100, {v2220, v2110, v2000, v2330}, {k1510, k1110, k0710, k310}, 0x63},
+	{v3200, {v2330, v2220, v2000, v2110}, {k1520, k1120, k0720, k320}, 0x63},
+	{v3300, {v2000, v2330, v2110, v2220}, {k1530, k1130, k0730, k330}, 0x63},
+	{v3010, {v2120, v2010, v2230, v2300}, {k1500, k0700}, 0x63},
+	{v3110, {v2230, v2120, v2010, v2300}, {k1510, k0710}, 0x63},
+	{v3210, {v2300, v2230, v2010, v2120}, {k1520, k0720}, 0x63},
+	{v3310, {v2010, v2300, v2120, v2230}, {k1530, k0730}, 0x63},
+	{v3020, {v2130, v2020, v2200, v2310}, {k1500, k1100}, 0x63},
+	{v3120, {v2200, v2130, v2020, v2310}, {k1510, k1110}, 0x63},
+	{v3220, {v2310, v2200, v2020, v2130}, {k1520, k1120}, 0x63},
+	{v3320, {v2020, v2310, v2130, v2200}, {k1530, k1130}, 0x63},
+	{v3030, {v2100, v2030, v2210, v2320}, {k1500}, 0x63},
+	{v3130, {v2210, v2100, v2030, v2320}, {k1510}, 0x63},
+	{v3230, {v2320, v2210, v2030, v2100}, {k1520}, 0x63},
+	{v3330, {v2030, v2320, v2100, v2210}, {k1530}, 0x63},
+	{v4000, {v3110, v3000, v3220, v3330}, {k1900, k1500, k1100, k0700}, 0x63},
+	{v4100, {v3220, v3110, v3000, v3330}, {k1910, k1510, k1110, k0710}, 0x63},
+	{v4200, {v3330, v3220, v3000, v3110}, {k1920, k1520, k1120, k0720}, 0x63},
+	{v4300, {v3000, v3330, v3110, v3220}, {k1930, k1530, k1130, k0730}, 0x63},
+	{v4010, {v3120, v3010, v3230, v3300}, {k1900, k1100}, 0x63},
+	{v4110, {v3230, v3120, v3010, v3300}, {k1910, k1110}, 0x63},
+	{v4210, {v3300, v3230, v3010, v3120}, {k1920, k1120}, 0x63},
+	{v4310, {v3010, v3300, v3120, v3230}, {k1930, k1130}, 0x63},
+	{v4020, {v3130, v3020, v3200, v3310}, {k1900, k1500}, 0x63},
+	{v4120, {v3200, v3130, v3020, v3310}, {k1910, k1510}, 0x63},
+	{v4220, {v3310, v3200, v3020, v3130}, {k1920, k1520}, 0x63},
+	{v4320, {v3020, v3310, v3130, v3200}, {k1930, k1530}, 0x63},
+	{v4030, {v3100, v3030, v3210, v3320}, {k1900}, 0x63},
+	{v4130, {v3210, v3100, v3030, v3320}, {k1910}, 0x63},
+	{v4230, {v3320, v3210, v3030, v3100}, {k1920}, 0x63},
+	{v4330, {v3030, v3320, v3100, v3210}, {k1930}, 0x63},
+	{v5000, {v4110, v4000, v4220, v4330}, {k2300, k1900, k1500, k1100}, 0x63},
+	{v5100, {v4220, v4110, v4000, v4330}, {k2310, k1910, k1510, k1110}, 0x63},
+	{v5200, {v4330, v4220, v4000, v4110}, {k2320, k1920, k1520, k1120}, 0x63},
+	{v5300, {v4000, v4330, v4110, v4220}, {k2330, k1930, k1530, k1130}, 0x63},
+	{v5010, {v4120, v4010, v4230, v4300}, {k2300, k1500}, 0x63},
+	{v5110, {v4230, v4120, v4010, v4300}, {k2310, k1510}, 0x63},
+	{v5210, {v4300, v4230, v4010, v4120}, {k2320, k1520}, 0x63},
+	{v5310, {v4010, v4300, v4120, v4230}, {k2330, k1530}, 0x63},
+	{v5020, {v4130, v4020, v4200, v4310}, {k2300, k1900}, 0x63},
+	{v5120, {v4200, v4130, v4020, v4310}, {k2310, k1910}, 0x63},
+	{v5220, {v4310, v4200, v4020, v4130}, {k2320, k1920}, 0x63},
+	{v5320, {v4020, v4310, v4130, v4200}, {k2330, k1930}, 0x63},
+	{v5030, {v4100, v4030, v4210, v4320}, {k2300}, 0x63},
+	{v5130, {v4210, v4100, v4030, v4320}, {k2310}, 0x63},
+	{v5230, {v4320, v4210, v4030, v4100}, {k2320}, 0x63},
+	{v5330, {v4030, v4320, v4100, v4210}, {k2330}, 0x63},
+	{v6000, {v5110, v5000, v5220, v5330}, {k2700, k2300, k1900, k1500}, 0x63},
+	{v6100, {v5220, v5110, v5000, v5330}, {k2710, k2310, k1910, k1510}, 0x63},
+	{v6200, {v5330, v5220, v5000, v5110}, {k2720, k2320, k1920, k1520}, 0x63},
+	{v6300, {v5000, v5330, v5110, v5220}, {k2730, k2330, k1930, k1530}, 0x63},
+	{v6010, {v5120, v5010, v5230, v5300}, {k2700, k1900}, 0x63},
+	{v6110, {v5230, v5120, v5010, v5300}, {k2710, k1910}, 0x63},
+	{v6210, {v5300, v5230, v5010, v5120}, {k2720, k1920}, 0x63},
+	{v6310, {v5010, v5300, v5120, v5230}, {k2730, k1930}, 0x63},
+	{v6020, {v5130, v5020, v5200, v5310}, {k2700, k2300}, 0x63},
+	{v6120, {v5200, v5130, v5020, v5310}, {k2710, k2310}, 0x63},
+	{v6220, {v5310, v5200, v5020, v5130}, {k2720, k2320}, 0x63},
+	{v6320, {v5020, v5310, v5130, v5200}, {k2730, k2330}, 0x63},
+	{v6030, {v5100, v5030, v5210, v5320}, {k2700}, 0x63},
+	{v6130, {v5210, v5100, v5030, v5320}, {k2710}, 0x63},
+	{v6230, {v5320, v5210, v5030, v5100}, {k2720}, 0x63},
+	{v6330, {v5030, v5320, v5100, v5210}, {k2730}, 0x63},
+	{v7000, {v6110, v6000, v6220, v6330}, {k3100, k2700, k2300, k1900}, 0x63},
+	{v7100, {v6220, v6110, v6000, v6330}, {k3110, k2710, k2310, k1910}, 0x63},
+	{v7200, {v6330, v6220, v6000, v6110}, {k3120, k2720, k2320, k1920}, 0x63},
+	{v7300, {v6000, v6330, v6110, v6220}, {k3130, k2730, k2330, k1930}, 0x63},
+	{v7010, {v6120, v6010, v6230, v6300}, {k3100, k2300}, 0x63},
+	{v7110, {v6230, v6120, v6010, v6300}, {k3110, k2310}, 0x63},
+	{v7210, {v6300, v6230, v6010, v6120}, {k3120, k2320}, 0x63},
+	{v7310, {v6010, v6300, v6120, v6230}, {k3130, k2330}, 0x63},
+	{v7020, {v6130, v6020, v6200, v6310}, {k3100, k2700}, 0x63},
+	{v7120, {v6200, v6130, v6020, v6310}, {k3110, k2710}, 0x63},
+	{v7220, {v6310, v6200, v6020, v6130}, {k3120, k2720}, 0x63},
+	{v7320, {v6020, v6310, v6130, v6200}, {k3130, k2730}, 0x63},
+	{v7030, {v6100, v6030, v6210, v6320}, {k3100}, 0x63},
+	{v7130, {v6210, v6100, v6030, v6320}, {k3110}, 0x63},
+	{v7230, {v6320, v6210, v6030, v6100}, {k3120}, 0x63},
+	{v7330, {v6030, v6320, v6100, v6210}, {k3130}, 0x63},
+	{v8000, {v7110, v7000, v7220, v7330}, {k3500, k3100, k2700, k2300}, 0x63},
+	{v8100, {v7220, v7110, v7000, v7330}, {k3510, k3110, k2710, k2310}, 0x63},
+	{v8200, {v7330, v7220, v7000, v7110}, {k3520, k3120, k2720, k2320}, 0x63},
+	{v8300, {v7000, v7330, v7110, v7220}, {k3530, k3130, k2730, k2330}, 0x63},
+	{v8010, {v7120, v7010, v7230, v7300}, {k3500, k2700}, 0x63},
+	{v8110, {v7230, v7120, v7010, v7300}, {k3510, k2710}, 0x63},
+	{v8210, {v7300, v7230, v7010, v7120}, {k3520, k2720}, 0x63},
+	{v8310, {v7010, v7300, v7120, v7230}, {k3530, k2730}, 0x63},
+	{v8020, {v7130, v7020, v7200, v7310}, {k3500, k3100}, 0x63},
+	{v8120, {v7200, v7130, v7020, v7310}, {k3510, k3110}, 0x63},
+	{v8220, {v7310, v7200, v7020, v7130}, {k3520, k3120}, 0x63},
+	{v8320, {v7020, v7310, v7130, v7200}, {k3530, k3130}, 0x63},
+	{v8030, {v7100, v7030, v7210, v7320}, {k3500}, 0x63},
+	{v8130, {v7210, v7100, v7030, v7320}, {k3510}, 0x63},
+	{v8230, {v7320, v7210, v7030, v7100}, {k3520}, 0x63},
+	{v8330, {v7030, v7320, v7100, v7210}, {k3530}, 0x63},
+	{v9000, {v8110, v8000, v8220, v8330}, {k3900, k3500, k3100, k2700}, 0x63},
+	{v9100, {v8220, v8110, v8000, v8330}, {k3910, k3510, k3110, k2710}, 0x63},
+	{v9200, {v8330, v8220, v8000, v8110}, {k3920, k3520, k3120, k2720}, 0x63},
+	{v9300, {v8000, v8330, v8110, v8220}, {k3930, k3530, k3130, k2730}, 0x63},
+	{v9010, {v8120, v8010, v8230, v8300}, {k3900, k3100}, 0x63},
+	{v9110, {v8230, v8120, v8010, v8300}, {k3910, k3110}, 0x63},
+	{v9210, {v8300, v8230, v8010, v8120}, {k3920, k3120}, 0x63},
+	{v9310, {v8010, v8300, v8120, v8230}, {k3930, k3130}, 0x63},
+	{v9020, {v8130, v8020, v8200, v8310}, {k3900, k3500}, 0x63},
+	{v9120, {v8200, v8130, v8020, v8310}, {k3910, k3510}, 0x63},
+	{v9220, {v8310, v8200, v8020, v8130}, {k3920, k3520}, 0x63},
+	{v9320, {v8020, v8310, v8130, v8200}, {k3930, k3530}, 0x63},
+	{v9030, {v8100, v8030, v8210, v8320}, {k3900}, 0x63},
+	{v9130, {v8210, v8100, v8030, v8320}, {k3910}, 0x63},
+	{v9230, {v8320, v8210, v8030, v8100}, {k3920}, 0x63},
+	{v9330, {v8030, v8320, v8100, v8210}, {k3930}, 0x63},
+};
+
+/*
+ * Output, `dst = src ^ key[] ^ rcon` with `src` transformed by `aesLastRound[]`
+ */
+static const aesStep_t aesOutput[] = {
+	{o000, {v9000}, {k4300, k3900, k3500, k3100}, 0x63},
+	{o010, {v9110}, {k4310, k3910, k3510, k3110}, 0x63},
+	{o020, {v9220}, {k4320, k3920, k3520, k3120}, 0x63},
+	{o030, {v9330}, {k4330, k3930, k3530, k3130}, 0x63},
+	{o100, {v9010}, {k4300, k3500}, 0x63},
+	{o110, {v9120}, {k4310, k3510}, 0x63},
+	{o120, {v9230}, {k4320, k3520}, 0x63},
+	{o130, {v9300}, {k4330, k3530}, 0x63},
+	{o200, {v9020}, {k4300, k3900}, 0x63},
+	{o210, {v9130}, {k4310, k3910}, 0x63},
+	{o220, {v9200}, {k4320, k3920}, 0x63},
+	{o230, {v9310}, {k4330, k3930}, 0x63},
+	{o300, {v9030}, {k4300}, 0x63},
+	{o310, {v9100}, {k4310}, 0x63},
+	{o320, {v9210}, {k4320}, 0x63},
+	{o330, {v9320}, {k4330}, 0x63},
+};
@@ -0,0 +1,296 @@
+#ifndef _BUILDCIRCUIT_H
+#define _BUILDCIRCUIT_H
+
+/*
+ * @date 2022-03-14 00:24:38
+ *
+ * Table driven circuit builder.
+ *
+ * Subcircuits (S-boxes) are described as gate lists and layers as tables of box applications.
+ * The builder streams them into `baseTree_t::addNormaliseNode()`.
+ * This replaces the straight-line generated functions that needed `optimize("O0")` to compile in reasonable time.
+ *
+ * Gate operands are registers:
+ *   - 0 is constant zero
+ *   - `CIRCUIT_IN(i)` is box input `i`
+ *   - `CIRCUIT_GATE(i)` is the result of preceding gate `i`
+ * `CIRCUIT_INV` inverts an operand, `CIRCUIT_INV` on register 0 is constant one.
+ *
+ * Boxes applied to the same inputs within a layer are normalised together once into a template.
+ * Templates are cached and instantiated by remapping their placeholders onto the actual inputs.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2022, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <map>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include "basetree.h"
+
+enum {
+	CIRCUIT_MAXINPUT = 64,                        // maximum number of box inputs
+	CIRCUIT_FIRSTGATE = 1 + CIRCUIT_MAXINPUT,     // register of first gate result
+	CIRCUIT_INV = 0x8000,                         // operand inversion
+	CIRCUIT_KSTART = 2,                           // first template placeholder, after zero and error
+};
+
+#define CIRCUIT_IN(i)   (1 + (i))
+#define CIRCUIT_GATE(i) (CIRCUIT_FIRSTGATE + (i))
+
+/*
+ * Single `"Q ? T : F"` gate
+ */
+struct circuitGate_t {
+	uint16_t Q, T, F;
+};
+
+/*
+ * Subcircuit with a single output
+ */
+struct circuitBox_t {
+	uint16_t            numInputs; // number of inputs
+	uint16_t            numGates;  // length of gate list
+	const circuitGate_t *gates;    // gate list
+	uint16_t            result;    // operand containing the output
+};
+
+/*
+ * Application of a box within a layer.
+ * Box inputs are the consecutive state bits starting at `src`, the output is written to `dst`.
+ */
+struct circuitStep_t {
+	uint16_t dst;
+	uint16_t src;
+	uint16_t box;
+};
+
+/*
+ * Normalised multi-output subcircuit.
+ * Only gates reachable from the outputs are kept.
+ */
+struct circuitTemplate_t {
+	uint16_t                   numInputs; // number of inputs
+	std::vector<circuitGate_t> gates;     // gate list
+	std::vector<uint16_t>      results;   // operands containing the outputs, in order of box number
+};
+
+struct circuitBuilder_t {
+
+	/// @var {baseTree_t} tree receiving the nodes
+	baseTree_t                                                             &tree;
+	/// @var {uint32_t[]} register file
+	std::vector<uint32_t>                                                  regs;
+	/// @var {baseTree_t} scratch tree to normalise templates, inputs are the entrypoints
+	baseTree_t                                                             *pScratch;
+	/// @var {map} template cache, indexed by box table and bitmap of selected boxes
+	std::map<std::pair<const circuitBox_t *, uint64_t>, circuitTemplate_t> templates;
+
+	circuitBuilder_t(baseTree_t &tree) : tree(tree), regs(CIRCUIT_FIRSTGATE), pScratch(NULL), templates() {
+	}
+
+	~circuitBuilder_t() {
+		if (pScratch)
+			delete pScratch;
+	}
+
+	/*
+	 * Resolve operand to node id
+	 */
+	inline uint32_t operand(uint16_t op) const {
+		return regs[op & ~CIRCUIT_INV] ^ ((op & CIRCUIT_INV) ? IBIT : 0);
+	}
+
+	/*
+	 * `"L ^ R"`
+	 */
+	inline uint32_t XOR(uint32_t L, uint32_t R) {
+		return tree.addNormaliseNode(L, R ^ IBIT, R);
+	}
+
+	/*
+	 * @date 2022-03-14 00:34:16
+	 *
+	 * Normalise the boxes selected by `boxMask` into a template.
+	 * Boxes are added to a scratch tree with entrypoints as inputs, unreachable nodes are dropped.
+	 */
+	const circuitTemplate_t &lookupTemplate(const circuitBox_t *pBoxes, uint64_t boxMask) {
+		std::pair<const circuitBox_t *, uint64_t> key(pBoxes, boxMask);
+
+		std::map<std::pair<const circuitBox_t *, uint64_t>, circuitTemplate_t>::iterator it = templates.find(key);
+		if (it != templates.end())
+			return it->second;
+
+		assert(boxMask != 0);
+
+		unsigned numInputs = pBoxes[__builtin_ctzll(boxMask)].numInputs;
+		unsigned numGates  = 0;
+
+		assert(numInputs <= CIRCUIT_MAXINPUT);
+
+		for (unsigned iBox = 0; iBox < 64; iBox++) {
+			if (boxMask & (1ULL << iBox)) {
+				assert(pBoxes[iBox].numInputs == numInputs);
+				numGates += pBoxes[iBox].numGates;
+			}
+		}
+
+		/*
+		 * Normalise into scratch tree
+		 */
+		uint32_t nstart   = CIRCUIT_KSTART + numInputs;
+		uint32_t maxNodes = nstart + 16 * numGates + 256;
+
+		if (pScratch == NULL || pScratch->nstart != nstart || pScratch->maxNodes < maxNodes) {
+			if (pScratch)
+				delete pScratch;
+			pScratch = new baseTree_t(tree.ctx, CIRCUIT_KSTART, nstart, nstart, nstart, 0, maxNodes, tree.flags);
+		}
+		pScratch->rewind();
+
+		circuitBuilder_t      scratchBuilder(*pScratch);
+		std::vector<uint32_t> &scratchRegs = scratchBuilder.regs;
+		std::vector<uint32_t> roots;
+
+		scratchRegs[0] = 0;
+		for (unsigned i = 0; i < numInputs; i++)
+			scratchRegs[CIRCUIT_IN(i)] = CIRCUIT_KSTART + i;
+
+		// gates are added in list order, the same order as evaluating the boxes one by one
+		for (unsigned iBox = 0; iBox < 64; iBox++) {
+			if (boxMask & (1ULL << iBox)) {
+				const circuitBox_t &box = pBoxes[iBox];
+
+				if (scratchRegs.size() < (size_t) CIRCUIT_FIRSTGATE + box.numGates)
+					scratchRegs.resize(CIRCUIT_FIRSTGATE + box.numGates);
+
+				const circuitGate_t *pGate = box.gates;
+				for (unsigned i = 0; i < box.numGates; i++, pGate++)
+					scratchRegs[CIRCUIT_GATE(i)] = pScratch->addNormaliseNode(scratchBuilder.operand(pGate->Q), scratchBuilder.operand(pGate->T), scratchBuilder.operand(pGate->F));
+
+				roots.push_back(scratchBuilder.operand(box.result));
+			}
+		}
+
+		/*
+		 * Select reachable nodes and renumber them as gates
+		 */
+		uint32_t *pMap    = pScratch->allocMap();
+		uint32_t *pSelect = pScratch->allocMap();
+
+		for (uint32_t iNode = pScratch->nstart; iNode < pScratch->ncount; iNode++)
+			pSelect[iNode] = 0;
+		for (unsigned iRoot = 0; iRoot < roots.size(); iRoot++)
+			pSelect[roots[iRoot] & ~IBIT] = 1;
+
+		for (uint32_t iNode = pScratch->ncount - 1; iNode >= pScratch->nstart; --iNode) {
+			if (pSelect[iNode]) {
+				const baseNode_t *pNode = pScratch->N + iNode;
+
+				pSelect[pNode->Q]         = 1;
+				pSelect[pNode->T & ~IBIT] = 1;
+				pSelect[pNode->F]         = 1;
+			}
+		}
+
+		pMap[0] = 0;
+		for (unsigned i = 0; i < numInputs; i++)
+			pMap[CIRCUIT_KSTART + i] = CIRCUIT_IN(i);
+
+		circuitTemplate_t &tmpl = templates[key];
+
+		tmpl.numInputs = numInputs;
+
+		for (uint32_t iNode = pScratch->nstart; iNode < pScratch->ncount; iNode++) {
+			if (pSelect[iNode]) {
+				const baseNode_t *pNode = pScratch->N + iNode;
+				circuitGate_t    gate;
+
+				gate.Q = pMap[pNode->Q];
+				gate.T = pMap[pNode->T & ~IBIT] ^ ((pNode->T & IBIT) ? CIRCUIT_INV : 0);
+				gate.F = pMap[pNode->F];
+
+				pMap[iNode] = CIRCUIT_GATE(tmpl.gates.size());
+				tmpl.gates.push_back(gate);
+			}
+		}
+
+		for (unsigned iRoot = 0; iRoot < roots.size(); iRoot++)
+			tmpl.results.push_back(pMap[roots[iRoot] & ~IBIT] ^ ((roots[iRoot] & IBIT) ? CIRCUIT_INV : 0));
+
+		pScratch->freeMap(pSelect);
+		pScratch->freeMap(pMap);
+
+		return tmpl;
+	}
+
+	/*
+	 * @date 2022-03-14 00:35:02
+	 *
+	 * Instantiate template with given inputs, `pOutputs[]` receives one node id per selected box.
+	 * Nodes are re-normalised as the actual inputs may order differently than the placeholders.
+	 */
+	void applyTemplate(const circuitTemplate_t &tmpl, const uint32_t *pInputs, uint32_t *pOutputs) {
+		if (regs.size() < CIRCUIT_FIRSTGATE + tmpl.gates.size())
+			regs.resize(CIRCUIT_FIRSTGATE + tmpl.gates.size());
+
+		regs[0] = 0;
+		for (unsigned i = 0; i < tmpl.numInputs; i++)
+			regs[CIRCUIT_IN(i)] = pInputs[i];
+
+		const circuitGate_t *pGate = tmpl.gates.data();
+		for (unsigned i = 0; i < tmpl.gates.size(); i++, pGate++)
+			regs[CIRCUIT_GATE(i)] = tree.addNormaliseNode(operand(pGate->Q), operand(pGate->T), operand(pGate->F));
+
+		for (unsigned i = 0; i < tmpl.results.size(); i++)
+			pOutputs[i] = operand(tmpl.results[i]);
+	}
+
+	/*
+	 * @date 2022-03-14 00:25:31
+	 *
+	 * Apply a layer of boxes to `pState` and store the outputs in `pNext`.
+	 * `pState` and `pNext` must not overlap.
+	 * Consecutive steps reading the same inputs share a single template instantiation.
+	 */
+	void applyLayer(const circuitStep_t *pSteps, unsigned numSteps, const circuitBox_t *pBoxes, const uint32_t *pState, uint32_t *pNext) {
+		uint32_t outputs[64];
+
+		for (unsigned iStep = 0; iStep < numSteps;) {
+			// collect steps sharing the same inputs
+			uint64_t boxMask = 0;
+			unsigned iLast   = iStep;
+
+			while (iLast < numSteps && pSteps[iLast].src == pSteps[iStep].src) {
+				assert(pSteps[iLast].box < 64);
+				boxMask |= 1ULL << pSteps[iLast].box;
+				iLast++;
+			}
+
+			applyTemplate(lookupTemplate(pBoxes, boxMask), pState + pSteps[iStep].src, outputs);
+
+			// outputs are ordered by box number
+			for (; iStep < iLast; iStep++)
+				pNext[pSteps[iStep].dst] = outputs[__builtin_popcountll(boxMask & ((1ULL << pSteps[iStep].box) - 1))];
+		}
+	}
+};
+
+#endif
@@ -0,0 +1,227 @@
+/*
+ * builddesstep.h
+ * 	Tables driving the DES rounds, bit numbers are relative to the 32-bit halves.
+ */
+
+/*
+ * Order in which the rounds apply the S-boxes
+ */
+static const uint8_t desBoxOrder[8] = {0, 2, 4, 6, 1, 3, 5, 7};
+
+/*
+ * Expansion, bits of the right half feeding S-box inputs 0-5
+ */
+static const uint8_t desExpansion[8][6] = {
+	{ 0,  1,  2,  3,  4,  5},
+	{ 4,  5,  6,  7,  8,  9},
+	{ 8,  9, 10, 11, 12, 13},
+	{12, 13, 14, 15, 16, 17},
+	{16, 17, 18, 19, 20, 21},
+	{20, 21, 22, 23, 24, 25},
+	{24, 25, 26, 27, 28, 29},
+	{28, 29, 30, 31,  0,  1},
+};
+
+/*
+ * Permutation, bits receiving the outputs of S-box `s`, output `j` being `desBoxes[s*4+j]`
+ */
+static const uint8_t desPermutation[8][4] = {
+	{ 9, 17, 23, 31},
+	{ 2, 13, 18, 28},
+	{ 6, 16, 24, 30},
+	{ 1, 10, 20, 26},
+	{ 3,  8, 14, 25},
+	{ 4, 11, 19, 29},
+	{ 0,  7, 12, 22},
+	{ 5, 15, 21, 27},
+};
+
+/*
+ * Initial permutation, input bits forming the left and right halves
+ */
+static const uint16_t desInitial[2][32] = {
+	{
+		i00, i76, i66, i56, i46, i36, i26, i16, i06, i74, i64, i54, i44, i34, i24, i14,
+		i04, i72, i62, i52, i42, i32, i22, i12, i02, i70, i60, i50, i40, i30, i20, i10,
+	},
+	{
+		i01, i77, i67, i57, i47, i37, i27, i17, i07, i75, i65, i55, i45, i35, i25, i15,
+		i05, i73, i63, i53, i43, i33, i23, i13, i03, i71, i61, i51, i41, i31, i21, i11,
+	},
+};
+
+/*
+ * Key schedule, key bits added to S-box inputs 0-5 for each round
+ */
+static const uint16_t desKeys[16][8][6] = {
+	{
+		{k16, k65, k46, k74, k67, k27},
+		{k47, k77, k06, k17, k25, k56},
+		{k05, k45, k36, k37, k54, k76},
+		{k75, k07, k44, k35, k26, k57},
+		{k22, k34, k41, k62, k43, k04},
+		{k51, k32, k03, k63, k21, k33},
+		{k73, k23, k42, k71, k11, k24},
+		{k53, k12, k13, k72, k61, k31},
+	},
+	{
+		{k06, k55, k36, k64, k57, k17},
+		{k37, k67, k75, k07, k15, k46},
+		{k74, k35, k26, k27, k44, k66},
+		{k65, k76, k77, k25, k16, k47},
+		{k12, k24, k31, k52, k33, k71},
+		{k41, k22, k34, k53, k11, k23},
+		{k63, k13, k32, k61, k01, k14},
+		{k43, k02, k03, k62, k51, k21},
+	},
+	{
+		{k65, k35, k16, k44, k37, k76},
+		{k17, k47, k55, k66, k74, k26},
+		{k54, k15, k06, k07, k67, k46},
+		{k45, k56, k57, k05, k75, k27},
+		{k73, k04, k11, k32, k13, k51},
+		{k21, k02, k14, k33, k72, k03},
+		{k43, k34, k12, k41, k62, k71},
+		{k23, k63, k24, k42, k31, k01},
+	},
+	{
+		{k45, k15, k75, k67, k17, k56},
+		{k76, k27, k35, k46, k54, k06},
+		{k77, k74, k65, k66, k47, k26},
+		{k25, k36, k37, k64, k55, k07},
+		{k53, k61, k72, k12, k34, k31},
+		{k01, k63, k71, k13, k52, k24},
+		{k23, k14, k73, k21, k42, k51},
+		{k03, k43, k04, k22, k11, k62},
+	},
+	{
+		{k25, k74, k55, k47, k76, k36},
+		{k56, k07, k15, k26, k77, k65},
+		{k57, k54, k45, k46, k27, k06},
+		{k05, k16, k17, k44, k35, k66},
+		{k33, k41, k52, k73, k14, k11},
+		{k62, k43, k51, k34, k32, k04},
+		{k03, k71, k53, k01, k22, k31},
+		{k24, k23, k61, k02, k72, k42},
+	},
+	{
+		{k05, k54, k35, k27, k56, k16},
+		{k36, k66, k74, k06, k57, k45},
+		{k37, k77, k25, k26, k07, k65},
+		{k64, k75, k76, k67, k15, k46},
+		{k13, k21, k32, k53, k71, k72},
+		{k42, k23, k31, k14, k12, k61},
+		{k24, k51, k33, k62, k02, k11},
+		{k04, k03, k41, k63, k52, k22},
+	},
+	{
+		{k64, k77, k15, k07, k36, k75},
+		{k16, k46, k54, k65, k37, k25},
+		{k17, k57, k05, k06, k66, k45},
+		{k44, k55, k56, k47, k74, k26},
+		{k34, k01, k12, k33, k51, k52},
+		{k22, k03, k11, k71, k73, k41},
+		{k04, k31, k13, k42, k63, k72},
+		{k61, k24, k21, k43, k32, k02},
+	},
+	{
+		{k44, k57, k74, k66, k16, k55},
+		{k75, k26, k77, k45, k17, k05},
+		{k76, k37, k64, k65, k46, k25},
+		{k67, k35, k36, k27, k54, k06},
+		{k14, k62, k73, k13, k31, k32},
+		{k02, k24, k72, k51, k53, k21},
+		{k61, k11, k34, k22, k43, k52},
+		{k41, k04, k01, k23, k12, k63},
+	},
+	{
+		{k77, k47, k64, k56, k06, k45},
+		{k65, k16, k67, k35, k07, k74},
+		{k66, k27, k54, k55, k36, k15},
+		{k57, k25, k26, k17, k44, k75},
+		{k04, k52, k63, k03, k21, k22},
+		{k73, k14, k62, k41, k43, k11},
+		{k51, k01, k24, k12, k33, k42},
+		{k31, k71, k72, k13, k02, k53},
+	},
+	{
+		{k57, k27, k44, k36, k65, k25},
+		{k45, k75, k47, k15, k66, k54},
+		{k46, k07, k77, k35, k16, k74},
+		{k37, k05, k06, k76, k67, k55},
+		{k61, k32, k43, k24, k01, k02},
+		{k53, k71, k42, k21, k23, k72},
+		{k31, k62, k04, k73, k13, k22},
+		{k11, k51, k52, k34, k63, k33},
+	},
+	{
+		{k37, k07, k67, k16, k45, k05},
+		{k25, k55, k27, k74, k46, k77},
+		{k26, k66, k57, k15, k75, k54},
+		{k17, k64, k65, k56, k47, k35},
+		{k41, k12, k23, k04, k62, k63},
+		{k33, k51, k22, k01, k03, k52},
+		{k11, k42, k61, k53, k34, k02},
+		{k72, k31, k32, k14, k43, k13},
+	},
+	{
+		{k17, k66, k47, k75, k25, k64},
+		{k05, k35, k07, k54, k26, k57},
+		{k06, k46, k37, k74, k55, k77},
+		{k76, k44, k45, k36, k27, k15},
+		{k21, k73, k03, k61, k42, k43},
+		{k13, k31, k02, k62, k24, k32},
+		{k72, k22, k41, k33, k14, k63},
+		{k52, k11, k12, k71, k23, k34},
+	},
+	{
+		{k76, k46, k27, k55, k05, k44},
+		{k64, k15, k66, k77, k06, k37},
+		{k65, k26, k17, k54, k35, k57},
+		{k56, k67, k25, k16, k07, k74},
+		{k01, k53, k24, k41, k22, k23},
+		{k34, k11, k63, k42, k04, k12},
+		{k52, k02, k21, k13, k71, k43},
+		{k32, k72, k73, k51, k03, k14},
+	},
+	{
+		{k56, k26, k07, k35, k64, k67},
+		{k44, k74, k46, k57, k65, k17},
+		{k45, k06, k76, k77, k15, k37},
+		{k36, k47, k05, k75, k66, k54},
+		{k62, k33, k04, k21, k02, k03},
+		{k14, k72, k43, k22, k61, k73},
+		{k32, k63, k01, k34, k51, k23},
+		{k12, k52, k53, k31, k24, k71},
+	},
+	{
+		{k36, k06, k66, k15, k44, k47},
+		{k67, k54, k26, k37, k45, k76},
+		{k25, k65, k56, k57, k74, k17},
+		{k16, k27, k64, k55, k46, k77},
+		{k42, k13, k61, k01, k63, k24},
+		{k71, k52, k23, k02, k41, k53},
+		{k12, k43, k62, k14, k31, k03},
+		{k73, k32, k33, k11, k04, k51},
+	},
+	{
+		{k26, k75, k56, k05, k77, k37},
+		{k57, k44, k16, k27, k35, k66},
+		{k15, k55, k46, k47, k64, k07},
+		{k06, k17, k54, k45, k36, k67},
+		{k32, k03, k51, k72, k53, k14},
+		{k61, k42, k13, k73, k31, k43},
+		{k02, k33, k52, k04, k21, k34},
+		{k63, k22, k23, k01, k71, k41},
+	},
+};
+
+/*
+ * Final permutation, outputs receiving the bits of the last two rounds
+ */
+static const uint16_t desOutput[64] = {
+	o01, o77, o67, o57, o47, o37, o27, o17, o07, o75, o65, o55, o45, o35, o25, o15,
+	o05, o73, o63, o53, o43, o33, o23, o13, o03, o71, o61, o51, o41, o31, o21, o11,
+	o00, o76, o66, o56, o46, o36, o26, o16, o06, o74, o64, o54, o44, o34, o24, o14,
+	o04, o72, o62, o52, o42, o32, o22, o12, o02, o70, o60, o50, o40, o30, o20, o10,
+};
@@ -110,6 +110,87 @@ struct NODE {
 	NODE operator^(const NODE &other) const { return NODE(this->id, other.id ^ IBIT, other.id); }
 };
 
+/*
+ * @date 2022-03-14 01:05:09
+ *
+ * Steps of the four rounds, `Q = C + ((A + F(B,C,D) + K + VAL) <<< R)`
+ */
+struct md5Step_t {
+	uint16_t Q, A, B, C, D, K;
+	uint32_t VAL;
+	uint8_t  R;
+};
+
+static const md5Step_t md5Steps[64] = {
+	{a000, ax00, cx00, bx00, dx00, k000, 0xd76aa478,  7},
+	{d000, dx00, bx00, a000, cx00, k100, 0xe8c7b756, 12},
+	{c000, cx00, a000, d000, bx00, k200, 0x242070db, 17},
+	{b000, bx00, d000, c000, a000, k300, 0xc1bdceee, 22},
+	{a100, a000, c000, b000, d000, k400, 0xf57c0faf,  7},
+	{d100, d000, b000, a100, c000, k500, 0x4787c62a, 12},
+	{c100, c000, a100, d100, b000, k600, 0xa8304613, 17},
+	{b100, b000, d100, c100, a100, k700, 0xfd469501, 22},
+	{a200, a100, c100, b100, d100, k800, 0x698098d8,  7},
+	{d200, d100, b100, a200, c100, k900, 0x8b44f7af, 12},
+	{c200, c100, a200, d200, b100, ka00, 0xffff5bb1, 17},
+	{b200, b100, d200, c200, a200, kb00, 0x895cd7be, 22},
+	{a300, a200, c200, b200, d200, kc00, 0x6b901122,  7},
+	{d300, d200, b200, a300, c200, kd00, 0xfd987193, 12},
+	{c300, c200, a300, d300, b200, ke00, 0xa679438e, 17},
+	{b300, b200, d300, c300, a300, kf00, 0x49b40821, 22},
+
+	{a400, a300, d300, b300, c300, k100, 0xf61e2562,  5},
+	{d400, d300, c300, a400, b300, k600, 0xc040b340,  9},
+	{c400, c300, b300, d400, a400, kb00, 0x265e5a51, 14},
+	{b400, b300, a400, c400, d400, k000, 0xe9b6c7aa, 20},
+	{a500, a400, d400, b400, c400, k500, 0xd62f105d,  5},
+	{d500, d400, c400, a500, b400, ka00, 0x02441453,  9},
+	{c500, c400, b400, d500, a500, kf00, 0xd8a1e681, 14},
+	{b500, b400, a500, c500, d500, k400, 0xe7d3fbc8, 20},
+	{a600, a500, d500, b500, c500, k900, 0x21e1cde6,  5},
+	{d600, d500, c500, a600, b500, ke00, 0xc33707d6,  9},
+	{c600, c500, b500, d600, a600, k300, 0xf4d50d87, 14},
+	{b600, b500, a600, c600, d600, k800, 0x455a14ed, 20},
+	{a700, a600, d600, b600, c600, kd00, 0xa9e3e905,  5},
+	{d700, d600, c600, a700, b600, k200, 0xfcefa3f8,  9},
+	{c700, c600, b600, d700, a700, k700, 0x676f02d9, 14},
+	{b700, b600, a700, c700, d700, kc00, 0x8d2a4c8a, 20},
+
+	{a800, a700, c700, b700, d700, k500, 0xfffa3942,  4},
+	{d800, d700, b700, a800, c700, k800, 0x8771f681, 11},
+	{c800, c700, a800, d800, b700, kb00, 0x6d9d6122, 16},
+	{b800, b700, d800, c800, a800, ke00, 0xfde5380c, 23},
+	{a900, a800, c800, b800, d800, k100, 0xa4beea44,  4},
+	{d900, d800, b800, a900, c800, k400, 0x4bdecfa9, 11},
+	{c900, c800, a900, d900, b800, k700, 0xf6bb4b60, 16},
+	{b900, b800, d900, c900, a900, ka00, 0xbebfbc70, 23},
+	{aa00, a900, c900, b900, d900, kd00, 0x289b7ec6,  4},
+	{da00, d900, b900, aa00, c900, k000, 0xeaa127fa, 11},
+	{ca00, c900, aa00, da00, b900, k300, 0xd4ef3085, 16},
+	{ba00, b900, da00, ca00, aa00, k600, 0x04881d05, 23},
+	{ab00, aa00, ca00, ba00, da00, k900, 0xd9d4d039,  4},
+	{db00, da00, ba00, ab00, ca00, kc00, 0xe6db99e5, 11},
+	{cb00, ca00, ab00, db00, ba00, kf00, 0x1fa27cf8, 16},
+	{bb00, ba00, db00, cb00, ab00, k200, 0xc4ac5665, 23},
+
+	{ac00, ab00, cb00, bb00, db00, k000, 0xf4292244,  6},
+	{dc00, db00, bb00, ac00, cb00, k700, 0x432aff97, 10},
+	{cc00, cb00, ac00, dc00, bb00, ke00, 0xab9423a7, 15},
+	{bc00, bb00, dc00, cc00, ac00, k500, 0xfc93a039, 21},
+	{ad00, ac00, cc00, bc00, dc00, kc00, 0x655b59c3,  6},
+	{dd00, dc00, bc00, ad00, cc00, k300, 0x8f0ccc92, 10},
+	{cd00, cc00, ad00, dd00, bc00, ka00, 0xffeff47d, 15},
+	{bd00, bc00, dd00, cd00, ad00, k100, 0x85845dd1, 21},
+	{ae00, ad00, cd00, bd00, dd00, k800, 0x6fa87e4f,  6},
+	{de00, dd00, bd00, ae00, cd00, kf00, 0xfe2ce6e0, 10},
+	{ce00, cd00, ae00, de00, bd00, k600, 0xa3014314, 15},
+	{be00, bd00, de00, ce00, ae00, kd00, 0x4e0811a1, 21},
+	{af00, ae00, ce00, be00, de00, k400, 0xf7537e82,  6},
+	{df00, de00, be00, af00, ce00, kb00, 0xbd3af235, 10},
+	{cf00, ce00, af00, df00, be00, k200, 0x2ad7d2bb, 15},
+	{bf00, be00, df00, cf00, af00, k900, 0xeb86d391, 21},
+};
+
 /**
  * @date 2021-05-16 23:10:57
  *
@@ -392,81 +473,30 @@ struct buildmd5Context_t {
 		}
 	}
 
-	void __attribute__((optimize("O0"))) build(NODE *V) {
+	void build(NODE *V) {
 		toN(V, ax00, 0x67452301);
 		toN(V, dx00, 0x10325476);
 		toN(V, cx00, 0x98badcfe);
 		toN(V, bx00, 0xefcdab89);
 
-		//@formatter:off
-		F1(V,a000,ax00,cx00,bx00,dx00,k000,0xd76aa478, 7);
-		F1(V,d000,dx00,bx00,a000,cx00,k100,0xe8c7b756,12);
-		F1(V,c000,cx00,a000,d000,bx00,k200,0x242070db,17);
-		F1(V,b000,bx00,d000,c000,a000,k300,0xc1bdceee,22);
-		F1(V,a100,a000,c000,b000,d000,k400,0xf57c0faf, 7);
-		F1(V,d100,d000,b000,a100,c000,k500,0x4787c62a,12);
-		F1(V,c100,c000,a100,d100,b000,k600,0xa8304613,17);
-		F1(V,b100,b000,d100,c100,a100,k700,0xfd469501,22);
-		F1(V,a200,a100,c100,b100,d100,k800,0x698098d8, 7);
-		F1(V,d200,d100,b100,a200,c100,k900,0x8b44f7af,12);
-		F1(V,c200,c100,a200,d200,b100,ka00,0xffff5bb1,17);
-		F1(V,b200,b100,d200,c200,a200,kb00,0x895cd7be,22);
-		F1(V,a300,a200,c200,b200,d200,kc00,0x6b901122, 7);
-		F1(V,d300,d200,b200,a300,c200,kd00,0xfd987193,12);
-		F1(V,c300,c200,a300,d300,b200,ke00,0xa679438e,17);
-		F1(V,b300,b200,d300,c300,a300,kf00,0x49b40821,22);
-
-		F2(V,a400,a300,d300,b300,c300,k100,0xf61e2562, 5);
-		F2(V,d400,d300,c300,a400,b300,k600,0xc040b340, 9);
-		F2(V,c400,c300,b300,d400,a400,kb00,0x265e5a51,14);
-		F2(V,b400,b300,a400,c400,d400,k000,0xe9b6c7aa,20);
-		F2(V,a500,a400,d400,b400,c400,k500,0xd62f105d, 5);
-		F2(V,d500,d400,c400,a500,b400,ka00,0x02441453, 9);
-		F2(V,c500,c400,b400,d500,a500,kf00,0xd8a1e681,14);
-		F2(V,b500,b400,a500,c500,d500,k400,0xe7d3fbc8,20);
-		F2(V,a600,a500,d500,b500,c500,k900,0x21e1cde6, 5);
-		F2(V,d600,d500,c500,a600,b500,ke00,0xc33707d6, 9);
-		F2(V,c600,c500,b500,d600,a600,k300,0xF4d50d87,14);
-		F2(V,b600,b500,a600,c600,d600,k800,0x455a14ed,20);
-		F2(V,a700,a600,d600,b600,c600,kd00,0xa9e3e905, 5);
-		F2(V,d700,d600,c600,a700,b600,k200,0xfcefa3f8, 9);
-		F2(V,c700,c600,b600,d700,a700,k700,0x676f02d9,14);
-		F2(V,b700,b600,a700,c700,d700,kc00,0x8d2a4c8a,20);
-
-		F3(V,a800,a700,c700,b700,d700,k500,0xfffa3942, 4);
-		F3(V,d800,d700,b700,a800,c700,k800,0x8771f681,11);
-		F3(V,c800,c700,a800,d800,b700,kb00,0x6d9d6122,16);
-		F3(V,b800,b700,d800,c800,a800,ke00,0xfde5380c,23);
-		F3(V,a900,a800,c800,b800,d800,k100,0xa4beea44, 4);
-		F3(V,d900,d800,b800,a900,c800,k400,0x4bdecfa9,11);
-		F3(V,c900,c800,a900,d900,b800,k700,0xf6bb4b60,16);
-		F3(V,b900,b800,d900,c900,a900,ka00,0xbebfbc70,23);
-		F3(V,aa00,a900,c900,b900,d900,kd00,0x289b7ec6, 4);
-		F3(V,da00,d900,b900,aa00,c900,k000,0xeaa127fa,11);
-		F3(V,ca00,c900,aa00,da00,b900,k300,0xd4ef3085,16);
-		F3(V,ba00,b900,da00,ca00,aa00,k600,0x04881d05,23);
-		F3(V,ab00,aa00,ca00,ba00,da00,k900,0xd9d4d039, 4);
-		F3(V,db00,da00,ba00,ab00,ca00,kc00,0xe6db99e5,11);
-		F3(V,cb00,ca00,ab00,db00,ba00,kf00,0x1fa27cf8,16);
-		F3(V,bb00,ba00,db00,cb00,ab00,k200,0xc4ac5665,23);
-
-		F4(V,ac00,ab00,cb00,bb00,db00,k000,0xF4292244, 6);
-		F4(V,dc00,db00,bb00,ac00,cb00,k700,0x432aff97,10);
-		F4(V,cc00,cb00,ac00,dc00,bb00,ke00,0xab9423a7,15);
-		F4(V,bc00,bb00,dc00,cc00,ac00,k500,0xfc93a039,21);
-		F4(V,ad00,ac00,cc00,bc00,dc00,kc00,0x655b59c3, 6);
-		F4(V,dd00,dc00,bc00,ad00,cc00,k300,0x8f0ccc92,10);
-		F4(V,cd00,cc00,ad00,dd00,bc00,ka00,0xffefF47d,15);
-		F4(V,bd00,bc00,dd00,cd00,ad00,k100,0x85845dd1,21);
-		F4(V,ae00,ad00,cd00,bd00,dd00,k800,0x6fa87e4f, 6);
-		F4(V,de00,dd00,bd00,ae00,cd00,kf00,0xfe2ce6e0,10);
-		F4(V,ce00,cd00,ae00,de00,bd00,k600,0xa3014314,15);
-		F4(V,be00,bd00,de00,ce00,ae00,kd00,0x4e0811a1,21);
-		F4(V,af00,ae00,ce00,be00,de00,k400,0xf7537e82, 6);
-		F4(V,df00,de00,be00,af00,ce00,kb00,0xbd3af235,10);
-		F4(V,cf00,ce00,af00,df00,be00,k200,0x2ad7d2bb,15);
-		F4(V,bf00,be00,df00,cf00,af00,k900,0xeb86d391,21);
-		//@formatter:on
+		for (unsigned iStep = 0; iStep < 64; iStep++) {
+			const md5Step_t &step = md5Steps[iStep];
+
+			switch (iStep / 16) {
+			case 0:
+				F1(V, step.Q, step.A, step.B, step.C, step.D, step.K, step.VAL, step.R);
+				break;
+			case 1:
+				F2(V, step.Q, step.A, step.B, step.C, step.D, step.K, step.VAL, step.R);
+				break;
+			case 2:
+				F3(V, step.Q, step.A, step.B, step.C, step.D, step.K, step.VAL, step.R);
+				break;
+			case 3:
+				F4(V, step.Q, step.A, step.B, step.C, step.D, step.K, step.VAL, step.R);
+				break;
+			}
+		}
 
 		addC3(V, o00, af00, 0x67452301);
 		addC3(V, oc0, df00, 0x10325476);
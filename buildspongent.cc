@@ -29,10 +29,12 @@
 #include <getopt.h>
 #include <jansson.h>
 #include <stdint.h>
+#include <string.h>
 #include <sys/stat.h>
 
 #include "context.h"
 #include "basetree.h"
+#include "buildcircuit.h"
 #include "buildspongent.h"
 
 /*
@@ -67,25 +69,6 @@ void validate(const char *keyStr, const char *rootStr) {
  */
 #include "validatespongent.h"
 
-struct NODE {
-	uint32_t id;
-
-	NODE() { id = 0; }
-
-	NODE(uint32_t id) {
-		assert((id & ~IBIT) == 0 || ((id & ~IBIT) >= gTree->kstart && (id & ~IBIT) < gTree->ncount));
-		this->id = id;
-	}
-
-	NODE(NODE Q, NODE T, NODE F) { this->id = gTree->addNormaliseNode(Q.id, T.id, F.id); }
-
-	NODE operator|(const NODE &other) const { return NODE(this->id, IBIT, other.id); }
-
-	NODE operator*(const NODE &other) const { return NODE(this->id, other.id, 0); }
-
-	NODE operator^(const NODE &other) const { return NODE(this->id, other.id ^ IBIT, other.id); }
-};
-
 #include "buildspongentbox.h"
 
 /**
@@ -109,165 +92,63 @@ struct buildspongentContext_t {
 		opt_maxNode = DEFAULT_MAXNODE;
 	}
 
-	void __attribute__((optimize("O0"))) Permute(NODE value[11][8], NODE *V, uint32_t kstart, uint32_t ostart) {
+	/*
+	 * @date 2022-03-14 00:26:02
+	 *
+	 * Absorb/squeeze a single byte, state is 11 bytes as 88 bit-sliced node ids, byte 0 is rate.
+	 * Rounds are data driven by `spongentLayer[]` and `spongentBoxes[]`.
+	 */
+	void Permute(circuitBuilder_t &builder, uint32_t *pState, uint32_t *V, uint32_t kstart, uint32_t ostart) {
 
+		static const uint8_t IV[]     = {0x05, 0x0a, 0x14, 0x29, 0x13, 0x27, 0x0f, 0x1e, 0x3d, 0x3a, 0x34, 0x28, 0x11, 0x23, 0x07, 0x0e, 0x1c, 0x39, 0x32, 0x24, 0x09, 0x12, 0x25, 0x0b, 0x16, 0x2d, 0x1b, 0x37, 0x2e, 0x1d, 0x3b, 0x36, 0x2c, 0x19, 0x33, 0x26, 0x0d, 0x1a, 0x35, 0x2a, 0x15, 0x2b, 0x17, 0x2f, 0x1f};
+		static const uint8_t INV_IV[] = {0xa0, 0x50, 0x28, 0x94, 0xc8, 0xe4, 0xf0, 0x78, 0xbc, 0x5c, 0x2c, 0x14, 0x88, 0xc4, 0xe0, 0x70, 0x38, 0x9c, 0x4c, 0x24, 0x90, 0x48, 0xa4, 0xd0, 0x68, 0xb4, 0xd8, 0xec, 0x74, 0xb8, 0xdc, 0x6c, 0x34, 0x98, 0xcc, 0x64, 0xb0, 0x58, 0xac, 0x54, 0xa8, 0xd4, 0xe8, 0xf4, 0xf8};
 
-		static int IV[]     = {0x05, 0x0a, 0x14, 0x29, 0x13, 0x27, 0x0f, 0x1e, 0x3d, 0x3a, 0x34, 0x28, 0x11, 0x23, 0x07, 0x0e, 0x1c, 0x39, 0x32, 0x24, 0x09, 0x12, 0x25, 0x0b, 0x16, 0x2d, 0x1b, 0x37, 0x2e, 0x1d, 0x3b, 0x36, 0x2c, 0x19, 0x33, 0x26, 0x0d, 0x1a, 0x35, 0x2a, 0x15, 0x2b, 0x17, 0x2f, 0x1f};
-		static int INV_IV[] = {0xa0, 0x50, 0x28, 0x94, 0xc8, 0xe4, 0xf0, 0x78, 0xbc, 0x5c, 0x2c, 0x14, 0x88, 0xc4, 0xe0, 0x70, 0x38, 0x9c, 0x4c, 0x24, 0x90, 0x48, 0xa4, 0xd0, 0x68, 0xb4, 0xd8, 0xec, 0x74, 0xb8, 0xdc, 0x6c, 0x34, 0x98, 0xcc, 0x64, 0xb0, 0x58, 0xac, 0x54, 0xa8, 0xd4, 0xe8, 0xf4, 0xf8};
+		/*
+		 * S-box and bit permutation layer.
+		 * `{dst, src, box}`: state bit `dst` is `box` applied to the byte starting at bit `src`.
+		 * NOTE: order is that of the original generated code, which determines node numbering.
+		 */
+		static const circuitStep_t spongentLayer[] = {
+			//@formatter:off
+			{ 7, 24, 4}, { 6, 24, 0}, { 5, 16, 4}, { 4, 16, 0}, { 3,  8, 4}, { 2,  8, 0}, { 1,  0, 4}, { 0,  0, 0},
+			{15, 56, 4}, {14, 56, 0}, {13, 48, 4}, {12, 48, 0}, {11, 40, 4}, {10, 40, 0}, { 9, 32, 4}, { 8, 32, 0},
+			{23,  0, 5}, {22,  0, 1}, {21, 80, 4}, {20, 80, 0}, {19, 72, 4}, {18, 72, 0}, {17, 64, 4}, {16, 64, 0},
+			{31, 32, 5}, {30, 32, 1}, {29, 24, 5}, {28, 24, 1}, {27, 16, 5}, {26, 16, 1}, {25,  8, 5}, {24,  8, 1},
+			{39, 64, 5}, {38, 64, 1}, {37, 56, 5}, {36, 56, 1}, {35, 48, 5}, {34, 48, 1}, {33, 40, 5}, {32, 40, 1},
+			{47,  8, 6}, {46,  8, 2}, {45,  0, 6}, {44,  0, 2}, {43, 80, 5}, {42, 80, 1}, {41, 72, 5}, {40, 72, 1},
+			{55, 40, 6}, {54, 40, 2}, {53, 32, 6}, {52, 32, 2}, {51, 24, 6}, {50, 24, 2}, {49, 16, 6}, {48, 16, 2},
+			{63, 72, 6}, {62, 72, 2}, {61, 64, 6}, {60, 64, 2}, {59, 56, 6}, {58, 56, 2}, {57, 48, 6}, {56, 48, 2},
+			{71, 16, 7}, {70, 16, 3}, {69,  8, 7}, {68,  8, 3}, {67,  0, 7}, {66,  0, 3}, {65, 80, 6}, {64, 80, 2},
+			{79, 48, 7}, {78, 48, 3}, {77, 40, 7}, {76, 40, 3}, {75, 32, 7}, {74, 32, 3}, {73, 24, 7}, {72, 24, 3},
+			{87, 80, 7}, {86, 80, 3}, {85, 72, 7}, {84, 72, 3}, {83, 64, 7}, {82, 64, 3}, {81, 56, 7}, {80, 56, 3},
+			//@formatter:on
+		};
 
-		NODE tmp[11][8];
+		uint32_t tmp[88];
 
 		if (kstart) {
-			value[0][0] = value[0][0] ^ V[kstart + 8 * 0 + 0];
-			value[0][1] = value[0][1] ^ V[kstart + 8 * 0 + 1];
-			value[0][2] = value[0][2] ^ V[kstart + 8 * 0 + 2];
-			value[0][3] = value[0][3] ^ V[kstart + 8 * 0 + 3];
-			value[0][4] = value[0][4] ^ V[kstart + 8 * 0 + 4];
-			value[0][5] = value[0][5] ^ V[kstart + 8 * 0 + 5];
-			value[0][6] = value[0][6] ^ V[kstart + 8 * 0 + 6];
-			value[0][7] = value[0][7] ^ V[kstart + 8 * 0 + 7];
+			for (unsigned i = 0; i < 8; i++)
+				pState[i] = builder.XOR(pState[i], V[kstart + i]);
 		}
 
-		for (int i = 0; i < 45; i++) {
-			//@formatter:off
-
-#define A 10
-
+		for (unsigned iRound = 0; iRound < 45; iRound++) {
 			// Add counter values
-			value[0][0] = value[0][0] ^ (IV[i]&0x01?IBIT:0);
-			value[0][1] = value[0][1] ^ (IV[i]&0x02?IBIT:0);
-			value[0][2] = value[0][2] ^ (IV[i]&0x04?IBIT:0);
-			value[0][3] = value[0][3] ^ (IV[i]&0x08?IBIT:0);
-			value[0][4] = value[0][4] ^ (IV[i]&0x10?IBIT:0);
-			value[0][5] = value[0][5] ^ (IV[i]&0x20?IBIT:0);
-			value[0][6] = value[0][6] ^ (IV[i]&0x40?IBIT:0);
-			value[0][7] = value[0][7] ^ (IV[i]&0x80?IBIT:0);
-			value[A][0] = value[A][0] ^ (INV_IV[i]&0x01?IBIT:0);
-			value[A][1] = value[A][1] ^ (INV_IV[i]&0x02?IBIT:0);
-			value[A][2] = value[A][2] ^ (INV_IV[i]&0x04?IBIT:0);
-			value[A][3] = value[A][3] ^ (INV_IV[i]&0x08?IBIT:0);
-			value[A][4] = value[A][4] ^ (INV_IV[i]&0x10?IBIT:0);
-			value[A][5] = value[A][5] ^ (INV_IV[i]&0x20?IBIT:0);
-			value[A][6] = value[A][6] ^ (INV_IV[i]&0x40?IBIT:0);
-			value[A][7] = value[A][7] ^ (INV_IV[i]&0x80?IBIT:0);
-
-			tmp[0][7] = box_4(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[0][6] = box_0(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[0][5] = box_4(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[0][4] = box_0(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[0][3] = box_4(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[0][2] = box_0(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[0][1] = box_4(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[0][0] = box_0(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[1][7] = box_4(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-			tmp[1][6] = box_0(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-			tmp[1][5] = box_4(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[1][4] = box_0(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[1][3] = box_4(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[1][2] = box_0(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[1][1] = box_4(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[1][0] = box_0(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[2][7] = box_5(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[2][6] = box_1(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[2][5] = box_4(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[2][4] = box_0(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[2][3] = box_4(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[2][2] = box_0(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[2][1] = box_4(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[2][0] = box_0(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[3][7] = box_5(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[3][6] = box_1(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[3][5] = box_5(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[3][4] = box_1(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[3][3] = box_5(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[3][2] = box_1(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[3][1] = box_5(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[3][0] = box_1(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[4][7] = box_5(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[4][6] = box_1(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[4][5] = box_5(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-			tmp[4][4] = box_1(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-			tmp[4][3] = box_5(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[4][2] = box_1(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[4][1] = box_5(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[4][0] = box_1(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[5][7] = box_6(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[5][6] = box_2(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[5][5] = box_6(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[5][4] = box_2(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[5][3] = box_5(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[5][2] = box_1(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[5][1] = box_5(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[5][0] = box_1(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[6][7] = box_6(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[6][6] = box_2(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[6][5] = box_6(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[6][4] = box_2(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[6][3] = box_6(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[6][2] = box_2(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[6][1] = box_6(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[6][0] = box_2(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[7][7] = box_6(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[7][6] = box_2(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[7][5] = box_6(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[7][4] = box_2(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[7][3] = box_6(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-			tmp[7][2] = box_2(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-			tmp[7][1] = box_6(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[7][0] = box_2(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[8][7] = box_7(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[8][6] = box_3(value[2][7], value[2][6], value[2][5], value[2][4], value[2][3], value[2][2], value[2][1], value[2][0]);
-			tmp[8][5] = box_7(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[8][4] = box_3(value[1][7], value[1][6], value[1][5], value[1][4], value[1][3], value[1][2], value[1][1], value[1][0]);
-			tmp[8][3] = box_7(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[8][2] = box_3(value[0][7], value[0][6], value[0][5], value[0][4], value[0][3], value[0][2], value[0][1], value[0][0]);
-			tmp[8][1] = box_6(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[8][0] = box_2(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[9][7] = box_7(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[9][6] = box_3(value[6][7], value[6][6], value[6][5], value[6][4], value[6][3], value[6][2], value[6][1], value[6][0]);
-			tmp[9][5] = box_7(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[9][4] = box_3(value[5][7], value[5][6], value[5][5], value[5][4], value[5][3], value[5][2], value[5][1], value[5][0]);
-			tmp[9][3] = box_7(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[9][2] = box_3(value[4][7], value[4][6], value[4][5], value[4][4], value[4][3], value[4][2], value[4][1], value[4][0]);
-			tmp[9][1] = box_7(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[9][0] = box_3(value[3][7], value[3][6], value[3][5], value[3][4], value[3][3], value[3][2], value[3][1], value[3][0]);
-			tmp[A][7] = box_7(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[A][6] = box_3(value[A][7], value[A][6], value[A][5], value[A][4], value[A][3], value[A][2], value[A][1], value[A][0]);
-			tmp[A][5] = box_7(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[A][4] = box_3(value[9][7], value[9][6], value[9][5], value[9][4], value[9][3], value[9][2], value[9][1], value[9][0]);
-			tmp[A][3] = box_7(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[A][2] = box_3(value[8][7], value[8][6], value[8][5], value[8][4], value[8][3], value[8][2], value[8][1], value[8][0]);
-			tmp[A][1] = box_7(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-			tmp[A][0] = box_3(value[7][7], value[7][6], value[7][5], value[7][4], value[7][3], value[7][2], value[7][1], value[7][0]);
-
-			value[0][0] = tmp[0][0]; value[0][1] = tmp[0][1]; value[0][2] = tmp[0][2]; value[0][3] = tmp[0][3]; value[0][4] = tmp[0][4]; value[0][5] = tmp[0][5]; value[0][6] = tmp[0][6]; value[0][7] = tmp[0][7];
-			value[1][0] = tmp[1][0]; value[1][1] = tmp[1][1]; value[1][2] = tmp[1][2]; value[1][3] = tmp[1][3]; value[1][4] = tmp[1][4]; value[1][5] = tmp[1][5]; value[1][6] = tmp[1][6]; value[1][7] = tmp[1][7];
-			value[2][0] = tmp[2][0]; value[2][1] = tmp[2][1]; value[2][2] = tmp[2][2]; value[2][3] = tmp[2][3]; value[2][4] = tmp[2][4]; value[2][5] = tmp[2][5]; value[2][6] = tmp[2][6]; value[2][7] = tmp[2][7];
-			value[3][0] = tmp[3][0]; value[3][1] = tmp[3][1]; value[3][2] = tmp[3][2]; value[3][3] = tmp[3][3]; value[3][4] = tmp[3][4]; value[3][5] = tmp[3][5]; value[3][6] = tmp[3][6]; value[3][7] = tmp[3][7];
-			value[4][0] = tmp[4][0]; value[4][1] = tmp[4][1]; value[4][2] = tmp[4][2]; value[4][3] = tmp[4][3]; value[4][4] = tmp[4][4]; value[4][5] = tmp[4][5]; value[4][6] = tmp[4][6]; value[4][7] = tmp[4][7];
-			value[5][0] = tmp[5][0]; value[5][1] = tmp[5][1]; value[5][2] = tmp[5][2]; value[5][3] = tmp[5][3]; value[5][4] = tmp[5][4]; value[5][5] = tmp[5][5]; value[5][6] = tmp[5][6]; value[5][7] = tmp[5][7];
-			value[6][0] = tmp[6][0]; value[6][1] = tmp[6][1]; value[6][2] = tmp[6][2]; value[6][3] = tmp[6][3]; value[6][4] = tmp[6][4]; value[6][5] = tmp[6][5]; value[6][6] = tmp[6][6]; value[6][7] = tmp[6][7];
-			value[7][0] = tmp[7][0]; value[7][1] = tmp[7][1]; value[7][2] = tmp[7][2]; value[7][3] = tmp[7][3]; value[7][4] = tmp[7][4]; value[7][5] = tmp[7][5]; value[7][6] = tmp[7][6]; value[7][7] = tmp[7][7];
-			value[8][0] = tmp[8][0]; value[8][1] = tmp[8][1]; value[8][2] = tmp[8][2]; value[8][3] = tmp[8][3]; value[8][4] = tmp[8][4]; value[8][5] = tmp[8][5]; value[8][6] = tmp[8][6]; value[8][7] = tmp[8][7];
-			value[9][0] = tmp[9][0]; value[9][1] = tmp[9][1]; value[9][2] = tmp[9][2]; value[9][3] = tmp[9][3]; value[9][4] = tmp[9][4]; value[9][5] = tmp[9][5]; value[9][6] = tmp[9][6]; value[9][7] = tmp[9][7];
-			value[A][0] = tmp[A][0]; value[A][1] = tmp[A][1]; value[A][2] = tmp[A][2]; value[A][3] = tmp[A][3]; value[A][4] = tmp[A][4]; value[A][5] = tmp[A][5]; value[A][6] = tmp[A][6]; value[A][7] = tmp[A][7];
-
-#undef A
+			for (unsigned i = 0; i < 8; i++) {
+				if (IV[iRound] & (1 << i))
+					pState[i] ^= IBIT;
+				if (INV_IV[iRound] & (1 << i))
+					pState[80 + i] ^= IBIT;
+			}
 
-			//@formatter:on
+			builder.applyLayer(spongentLayer, sizeof(spongentLayer) / sizeof(*spongentLayer), spongentBoxes, pState, tmp);
+
+			memcpy(pState, tmp, sizeof tmp);
 		}
 
 		if (ostart) {
-			V[ostart + 0] = value[0][0];
-			V[ostart + 1] = value[0][1];
-			V[ostart + 2] = value[0][2];
-			V[ostart + 3] = value[0][3];
-			V[ostart + 4] = value[0][4];
-			V[ostart + 5] = value[0][5];
-			V[ostart + 6] = value[0][6];
-			V[ostart + 7] = value[0][7];
+			for (unsigned i = 0; i < 8; i++)
+				V[ostart + i] = pState[i];
 		}
-
 //printf("%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x%02x\n", value[0].toInt(), value[1].toInt(),value[2].toInt(),value[3].toInt(),value[4].toInt(),value[5].toInt(),value[6].toInt(),value[7].toInt(),value[8].toInt(),value[9].toInt(),value[A].toInt());
 //9ecd2099c3037de47b9af6
 //59a34c4d698a6f4bbbdd73
@@ -296,38 +177,23 @@ struct buildspongentContext_t {
 
 	/*
 	 * Build spongent expression
-	 * Ints are replaced by node_t wrappers in vectors.
+	 * State is held as node ids.
 	 */
-	void __attribute__((optimize("O0"))) build(NODE *V) {
-		NODE value[11][8];
+	void build(uint32_t *V) {
+		circuitBuilder_t builder(*gTree);
+		uint32_t         state[88];
+
+		memset(state, 0, sizeof state);
 
 		// first _PSTART is main entrypoint
 
-		Permute(value, V, KSTART + 8 * 0, 0);
-		Permute(value, V, KSTART + 8 * 1, 0);
-		Permute(value, V, KSTART + 8 * 2, 0);
-		Permute(value, V, KSTART + 8 * 3, 0);
-		Permute(value, V, KSTART + 8 * 4, 0);
-		Permute(value, V, KSTART + 8 * 5, 0);
-		Permute(value, V, KSTART + 8 * 6, 0);
-		Permute(value, V, KSTART + 8 * 7, 0);
-		Permute(value, V, KSTART + 8 * 8, 0);
-		Permute(value, V, KSTART + 8 * 9, 0);
-		Permute(value, V, KSTART + 8 * 10, 0);
-
-		value[0][7] = value[0][7] ^ IBIT;
-
-		Permute(value, V, 0, OSTART + 8 * 0);
-		Permute(value, V, 0, OSTART + 8 * 1);
-		Permute(value, V, 0, OSTART + 8 * 2);
-		Permute(value, V, 0, OSTART + 8 * 3);
-		Permute(value, V, 0, OSTART + 8 * 4);
-		Permute(value, V, 0, OSTART + 8 * 5);
-		Permute(value, V, 0, OSTART + 8 * 6);
-		Permute(value, V, 0, OSTART + 8 * 7);
-		Permute(value, V, 0, OSTART + 8 * 8);
-		Permute(value, V, 0, OSTART + 8 * 9);
-		Permute(value, V, 0, OSTART + 8 * 10);
+		for (unsigned i = 0; i < 11; i++)
+			Permute(builder, state, V, KSTART + 8 * i, 0);
+
+		state[7] ^= IBIT;
+
+		for (unsigned i = 0; i < 11; i++)
+			Permute(builder, state, V, 0, OSTART + 8 * i);
 	}
 
 
@@ -336,10 +202,10 @@ struct buildspongentContext_t {
 		 * allocate and initialise placeholder/helper array references to variables
 		 * NOTE: use NSTART because this is the last intermediate as gTree->nstart might point to ESTART)
 		 */
-		NODE *V = (NODE *) malloc(VLAST * sizeof V[0]);
+		uint32_t *V = (uint32_t *) malloc(VLAST * sizeof V[0]);
 		V[0] = 0;
 		for (unsigned iEntry = 1; iEntry < KSTART; iEntry++)
-			V[iEntry].id = kError;
+			V[iEntry] = kError;
 		
 		/*
 		 * Allocate the build tree containing the complete formula
@@ -352,7 +218,7 @@ struct buildspongentContext_t {
 			// name
 			gTree->entryNames[iEntry - KSTART] = allNames[iEntry];
 			// add to vector
-			V[iEntry].id = iEntry;
+			V[iEntry] = iEntry;
 		}
 
 		// setup root names
@@ -372,7 +238,7 @@ struct buildspongentContext_t {
 		 * Assign the roots/entrypoints.
 		 */
 		for (unsigned iRoot = 0; iRoot < gTree->numRoots; iRoot++)
-			gTree->roots[iRoot] = V[OSTART + iRoot].id;
+			gTree->roots[iRoot] = V[OSTART + iRoot];
 
 		/*
 		 * Create tests as json object
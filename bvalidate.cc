@@ -67,6 +67,9 @@ void sigalrmHandler(int __attribute__ ((unused)) sig) {
  */
 struct bvalidateContext_t {
 
+	/// @constant {number} - Number of tests evaluated simultaneously, one per bit of `uint64_t`
+	enum { NUMLANES = 64 };
+
 	/// @var {number} --onlyifset, only validate non-zero root (consider them a cascading of OR intermediates)
 	unsigned opt_onlyIfSet;
 
@@ -154,7 +157,7 @@ struct bvalidateContext_t {
 
 		std::vector<std::string>        testNames;   // The names of the entries
 		std::map<std::string, unsigned> testLookup;  // Name lookup	
-		std::vector<uint32_t>           testData;    // Test values
+		std::vector<uint64_t>           testData;    // Test values, bit-sliced. One lane per test
 		std::vector<uint32_t>           entryMap;    // How tree entrypoints map onto test data
 		std::vector<uint32_t>           rootMap;     // How tree roots map onto test data
 
@@ -243,244 +246,296 @@ struct bvalidateContext_t {
 			json_delete(jList);
 		}
 
-		uint32_t *pEval = tree.allocMap(); // evaluation stack
+		/*
+		 * @date 2022-03-13 23:04:18
+		 *
+		 * Validate tree structure.
+		 * Node references do not depend on test data and are checked once instead of per test.
+		 * Nodes are evaluated in order, anything not an entrypoint or preceding node is undefined.
+		 */
+		for (uint32_t iNode = tree.nstart; iNode < tree.ncount; iNode++) {
+			const baseNode_t *pNode = tree.N + iNode;
+			const uint32_t   Q      = pNode->Q;
+			const uint32_t   Ti     = pNode->T & IBIT;
+			const uint32_t   Tu     = pNode->T & ~IBIT;
+			const uint32_t   F      = pNode->F;
+
+			// test range
+			if (Q >= tree.ncount || Tu >= tree.ncount || F >= tree.ncount) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node references out-of-range"));
+				json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+				json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
+				json_t *jNode = json_object();
+				json_object_set_new_nocheck(jNode, "q", json_integer(Q));
+				json_object_set_new_nocheck(jNode, "ti", json_integer(Ti ? 1 : 0));
+				json_object_set_new_nocheck(jNode, "tu", json_integer(Tu));
+				json_object_set_new_nocheck(jNode, "f", json_integer(F));
+				json_object_set_new_nocheck(jError, "node", jNode);
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
 
-		// convert ascii to hex and inject at the appropriate location
-		for (unsigned iTest = 0; iTest < gNumTests; iTest++) {
-			/*
-			 * Load/decode the test 
-			 */
+			// test for undefined
+			if ((Q != 0 && Q < tree.kstart) || Q >= iNode || (Tu != 0 && Tu < tree.kstart) || Tu >= iNode || (F != 0 && F < tree.kstart) || F >= iNode) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node values out-of-range"));
+				json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+				json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
+				json_t *jNode = json_object();
+				json_object_set_new_nocheck(jNode, "q", json_integer(Q));
+				json_object_set_new_nocheck(jNode, "ti", json_integer(Ti ? 1 : 0));
+				json_object_set_new_nocheck(jNode, "tu", json_integer(Tu));
+				json_object_set_new_nocheck(jNode, "f", json_integer(F));
+				json_object_set_new_nocheck(jError, "node", jNode);
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+		}
 
-			// extract test element
-			json_t     *jTest    = json_array_get(jTests, iTest);
-			const char *strEntry = json_string_value(json_array_get(jTest, 0));
-			const char *strRoots = json_string_value(json_array_get(jTest, 1));
+		for (unsigned iRoot = 0; iRoot < tree.numRoots; iRoot++) {
+			uint32_t R = tree.roots[iRoot] & ~IBIT;
 
-			// simple validation
-			if (!strEntry || !strRoots) {
+			if ((R != 0 && R < tree.kstart) || R >= tree.ncount) {
 				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("Incomplete test entry"));
-				json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-				json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("Root loads undefined"));
+				json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+				json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
+				json_object_set_new_nocheck(jError, "nid", json_integer(R));
 				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 			}
+		}
 
-			/*
-			 * decode entrypoint/root data
-			 */
-			unsigned iBit   = 0;
-			testData.resize(testNames.size());
-
-			// convert
-			for (unsigned iPos = 0; iPos < strlen(strEntry); /* increment in loop */ ) {
-				// skip spaces
-				if (isspace(strEntry[iPos])) {
-					iPos++;
-					continue;
+		/*
+		 * @date 2022-03-13 23:04:45
+		 *
+		 * Tests are evaluated bit-sliced, `NUMLANES` at a time.
+		 * Bit `iLane` of every `pEval[]`/`testData[]` word belongs to test `iBatch+iLane`.
+		 * The tree is walked once per batch instead of once per test.
+		 */
+		uint64_t *pEval = (uint64_t *) ctx.myAlloc("bvalidateContext_t::pEval", tree.ncount, sizeof(*pEval)); // evaluation stack
+
+		for (unsigned iBatch = 0; iBatch < gNumTests; iBatch += NUMLANES) {
+			const unsigned numLanes = (gNumTests - iBatch < NUMLANES) ? gNumTests - iBatch : NUMLANES;
+			const uint64_t laneMask = (numLanes == NUMLANES) ? ~0ULL : (1ULL << numLanes) - 1;
+
+			testData.assign(testNames.size(), 0);
+
+			// convert ascii to hex and inject at the appropriate location
+			for (unsigned iLane = 0; iLane < numLanes; iLane++) {
+				const unsigned iTest   = iBatch + iLane;
+				const uint64_t laneBit = 1ULL << iLane;
+
+				/*
+				 * Load/decode the test 
+				 */
+
+				// extract test element
+				json_t     *jTest    = json_array_get(jTests, iTest);
+				const char *strEntry = json_string_value(json_array_get(jTest, 0));
+				const char *strRoots = json_string_value(json_array_get(jTest, 1));
+
+				// simple validation
+				if (!strEntry || !strRoots) {
+					json_t *jError = json_object();
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Incomplete test entry"));
+					json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+					json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
 
-				unsigned byte = 0;
-
-				for (int iNibble = 0; iNibble < 2; iNibble++) {
-					char ch = strEntry[iPos++]; // loop decrement happens here
-
-					byte *= 16;
-
-					if (ch >= '0' && ch <= '9')
-						byte += ch - '0';
-					else if (ch >= 'A' && ch <= 'F')
-						byte += ch - 'A' + 10;
-					else if (ch >= 'a' && ch <= 'f')
-						byte += ch - 'a' + 10;
-					else {
-						json_t *jError = json_object();
-						json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad entry data in test entry"));
-						json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-						json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-						json_object_set_new_nocheck(jError, "key-data", json_string_nocheck(strEntry));
-						ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+				/*
+				 * decode entrypoint/root data
+				 */
+				unsigned iBit   = 0;
+
+				// convert
+				for (unsigned iPos = 0; iPos < strlen(strEntry); /* increment in loop */ ) {
+					// skip spaces
+					if (isspace(strEntry[iPos])) {
+						iPos++;
+						continue;
+					}
+
+					unsigned byte = 0;
+
+					for (int iNibble = 0; iNibble < 2; iNibble++) {
+						char ch = strEntry[iPos++]; // loop decrement happens here
+
+						byte *= 16;
+
+						if (ch >= '0' && ch <= '9')
+							byte += ch - '0';
+						else if (ch >= 'A' && ch <= 'F')
+							byte += ch - 'A' + 10;
+						else if (ch >= 'a' && ch <= 'f')
+							byte += ch - 'a' + 10;
+						else {
+							json_t *jError = json_object();
+							json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad entry data in test entry"));
+							json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+							json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+							json_object_set_new_nocheck(jError, "key-data", json_string_nocheck(strEntry));
+							ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+						}
+					}
+
+					for (unsigned k = 0; k < 8; k++) {
+						if (iBit < jsonTree.nstart - jsonTree.kstart) {
+							if (byte & (1 << k))
+								testData[iBit] |= laneBit;
+							iBit++;
+						}
 					}
 				}
 
-				for (unsigned k = 0; k < 8; k++) {
-					if (iBit < jsonTree.nstart - jsonTree.kstart)
-						testData[iBit++] = (byte & (1 << k)) ? ~0U : 0U;
+				if (iBit < jsonTree.nstart - jsonTree.kstart) {
+					json_t *jError = json_object();
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("entry data too short in test entry"));
+					json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+					json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+					json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.nstart - jsonTree.kstart));
+					json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
+					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
-			}
 
-			if (iBit < jsonTree.nstart - jsonTree.kstart) {
-				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("entry data too short in test entry"));
-				json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-				json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-				json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.nstart - jsonTree.kstart));
-				json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
-				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-			}
+				// convert
+				for (unsigned iPos = 0; iPos < strlen(strRoots); /* increment in loop */ ) {
+					// skip spaces
+					if (isspace(strRoots[iPos])) {
+						iPos++;
+						continue;
+					}
 
-			// convert
-			for (unsigned iPos = 0; iPos < strlen(strRoots); /* increment in loop */ ) {
-				// skip spaces
-				if (isspace(strRoots[iPos])) {
-					iPos++;
-					continue;
-				}
+					unsigned byte = 0;
+
+					for (int iNibble = 0; iNibble < 2; iNibble++) {
+						char ch = strRoots[iPos++]; // loop increment happens here
+
+						byte *= 16;
+
+						if (ch >= '0' && ch <= '9')
+							byte += ch - '0';
+						else if (ch >= 'A' && ch <= 'F')
+							byte += ch - 'A' + 10;
+						else if (ch >= 'a' && ch <= 'f')
+							byte += ch - 'a' + 10;
+						else {
+							json_t *jError = json_object();
+							json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad root data in test entry"));
+							json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+							json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+							json_object_set_new_nocheck(jError, "root-data", json_string_nocheck(strRoots));
+							ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+						}
+					}
 
-				unsigned byte = 0;
-
-				for (int iNibble = 0; iNibble < 2; iNibble++) {
-					char ch = strRoots[iPos++]; // loop increment happens here
-
-					byte *= 16;
-
-					if (ch >= '0' && ch <= '9')
-						byte += ch - '0';
-					else if (ch >= 'A' && ch <= 'F')
-						byte += ch - 'A' + 10;
-					else if (ch >= 'a' && ch <= 'f')
-						byte += ch - 'a' + 10;
-					else {
-						json_t *jError = json_object();
-						json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad root data in test entry"));
-						json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-						json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-						json_object_set_new_nocheck(jError, "root-data", json_string_nocheck(strRoots));
-						ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+					for (unsigned k = 0; k < 8; k++) {
+						if (iBit < (jsonTree.nstart - jsonTree.kstart) + jsonTree.numRoots) {
+							if (byte & (1 << k))
+								testData[iBit] |= laneBit;
+							iBit++;
+						}
 					}
 				}
 
-				for (unsigned k = 0; k < 8; k++) {
-					if (iBit < (jsonTree.nstart - jsonTree.kstart) + jsonTree.numRoots)
-						testData[iBit++] = (byte & (1 << k)) ? ~0U : 0U;
+				if (iBit < jsonTree.numRoots) {
+					json_t *jError = json_object();
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("root data too short in test entry"));
+					json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+					json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+					json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.numRoots));
+					json_object_set_new_nocheck(jError, "numroots", json_integer(iBit));
+					json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
+					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
 			}
 
-			if (iBit < jsonTree.numRoots) {
-				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("root data too short in test entry"));
-				json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-				json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-				json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.numRoots));
-				json_object_set_new_nocheck(jError, "numroots", json_integer(iBit));
-				json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
-				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-			}
-
 			/*
 			 * Prepare evaluator
 			 */
 
-			// set everything to an invalidation marker
-			for (unsigned iNode = 0; iNode < tree.ncount; iNode++)
-				pEval[iNode] = 0x5a5a5a5a; // set to invalid value
-
 			pEval[0] = 0; // only zero is well-defined
 
 			for (unsigned iEntry = tree.kstart; iEntry < tree.nstart; iEntry++)
 				pEval[iEntry] = testData[entryMap[iEntry - tree.kstart]];
 
 			/*
-			 * Run the test
+			 * Run the tests
 			 */
 			for (uint32_t iNode = tree.nstart; iNode < tree.ncount; iNode++) {
 				const baseNode_t *pNode = tree.N + iNode;
-				const uint32_t   Q      = pNode->Q;
-				const uint32_t   Ti     = pNode->T & IBIT;
-				const uint32_t   Tu     = pNode->T & ~IBIT;
-				const uint32_t   F      = pNode->F;
-
-				// test range
-				if (Q >= tree.ncount || Tu >= tree.ncount || F >= tree.ncount) {
-					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node references out-of-range"));
-					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
-					json_t *jNode = json_object();
-					json_object_set_new_nocheck(jNode, "q", json_integer(Q));
-					json_object_set_new_nocheck(jNode, "ti", json_integer(Ti ? 1 : 0));
-					json_object_set_new_nocheck(jNode, "tu", json_integer(Tu));
-					json_object_set_new_nocheck(jNode, "f", json_integer(F));
-					json_object_set_new_nocheck(jError, "node", jNode);
-					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-				}
-
-				// test for undefined
-				if ((pEval[Q] != 0 && pEval[Q] != ~0U) || (pEval[Tu] != 0 && pEval[Tu] != ~0U) || (pEval[F] != 0 && pEval[F] != ~0U)) {
-					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node values out-of-range"));
-					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
-					json_t *jNode = json_object();
-					json_object_set_new_nocheck(jNode, "q", json_integer(Q));
-					json_object_set_new_nocheck(jNode, "ti", json_integer(Ti ? 1 : 0));
-					json_object_set_new_nocheck(jNode, "tu", json_integer(Tu));
-					json_object_set_new_nocheck(jNode, "f", json_integer(F));
-					json_object_set_new_nocheck(jError, "node", jNode);
-					json_t *jValue = json_object();
-					json_object_set_new_nocheck(jValue, "q", json_integer(pEval[Q]));
-					json_object_set_new_nocheck(jValue, "ti", json_integer(pEval[Tu] & IBIT ? 1 : 0));
-					json_object_set_new_nocheck(jValue, "tu", json_integer(pEval[Tu] & ~IBIT));
-					json_object_set_new_nocheck(jValue, "f", json_integer(pEval[F]));
-					json_object_set_new_nocheck(jError, "value", jValue);
-					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-				}
+				const uint64_t   Q      = pEval[pNode->Q];
+				const uint64_t   Tu     = pEval[pNode->T & ~IBIT];
+				const uint64_t   F      = pEval[pNode->F];
 
 				/*
 				 * Apply QTF operator
 				 */
 
 				// determine if the operator is `QTF` or `QnTF`
-				if (Ti) {
+				if (pNode->T & IBIT) {
 					// `QnTF` apply the operator `"Q ? ~T : F"`
-					pEval[iNode] = (pEval[Q] & ~pEval[Tu]) ^ (~pEval[Q] & pEval[F]);
+					pEval[iNode] = (Q & ~Tu) ^ (~Q & F);
 				} else {
 					// `QTF` apply the operator `"Q ? T : F"`
-					pEval[iNode] = (pEval[Q] & pEval[Tu]) ^ (~pEval[Q] & pEval[F]);
+					pEval[iNode] = (Q & Tu) ^ (~Q & F);
 				}
 			}
 
 			/*
-			 * Compare the results for the provides
+			 * Compare the results for the provides.
+			 * Collect the failing lanes of all roots, then report the first failing test like a test-by-test run would.
 			 */
+			uint64_t allFailed = 0;
+			unsigned firstRoot[NUMLANES]; // first failing root per lane
+
 			for (unsigned iRoot = 0; iRoot < tree.numRoots; iRoot++) {
-				uint32_t expected = (tree.flags & context_t::MAGICMASK_SYSTEM) ? 0 : testData[rootMap[iRoot]];
+				uint64_t expected = (tree.flags & context_t::MAGICMASK_SYSTEM) ? 0 : testData[rootMap[iRoot]];
 				uint32_t R = tree.roots[iRoot];
-				uint32_t encountered = pEval[R & ~IBIT];
+				uint64_t encountered = pEval[R & ~IBIT];
 				if (R & IBIT)
-					encountered ^= ~0U;
+					encountered ^= ~0ULL;
 
-				// test for undefined. Initial value `pEval[]` is 0x5a5a5a5a.
-				if (pEval[R & ~IBIT] != 0 && pEval[R & ~IBIT] != ~0U) {
-					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Root loads undefined"));
-					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
-					json_object_set_new_nocheck(jError, "value", json_integer(pEval[R & ~IBIT]));
-					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-				}
+				// lanes that failed
+				uint64_t failed = (expected ^ encountered) & laneMask;
+				if (opt_onlyIfSet)
+					failed &= encountered;
 
-				if ((!opt_onlyIfSet || encountered) && expected != encountered) {
-					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("validation failed"));
-					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					if (tree.flags & context_t::MAGICMASK_SYSTEM)
-						json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
-					else
-						json_object_set_new_nocheck(jError, "root", json_string(testNames[rootMap[iRoot]].c_str()));
-					json_object_set_new_nocheck(jError, "expected", json_integer(expected));
-					json_object_set_new_nocheck(jError, "encountered", json_integer(encountered));
-					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-				}
+				// lanes failing for the first time
+				for (uint64_t newFailed = failed & ~allFailed; newFailed; newFailed &= newFailed - 1)
+					firstRoot[__builtin_ctzll(newFailed)] = iRoot;
+
+				allFailed |= failed;
+			}
+
+			if (allFailed) {
+				// report the first failing test of the batch
+				unsigned iLane = __builtin_ctzll(allFailed);
+				unsigned iRoot = firstRoot[iLane];
+
+				uint64_t expected = (tree.flags & context_t::MAGICMASK_SYSTEM) ? 0 : testData[rootMap[iRoot]];
+				uint32_t R = tree.roots[iRoot];
+				uint64_t encountered = pEval[R & ~IBIT];
+				if (R & IBIT)
+					encountered ^= ~0ULL;
+
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("validation failed"));
+				json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+				json_object_set_new_nocheck(jError, "testnr", json_integer(iBatch + iLane));
+				if (tree.flags & context_t::MAGICMASK_SYSTEM)
+					json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
+				else
+					json_object_set_new_nocheck(jError, "root", json_string(testNames[rootMap[iRoot]].c_str()));
+				json_object_set_new_nocheck(jError, "expected", json_integer((expected >> iLane) & 1 ? ~0U : 0U));
+				json_object_set_new_nocheck(jError, "encountered", json_integer((encountered >> iLane) & 1 ? ~0U : 0U));
+				json_object_set_new_nocheck(jError, "numfailed", json_integer(__builtin_popcountll(allFailed)));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 			}
 		}
 
 		fprintf(stderr, "Passed %d tests\n", gNumTests);
 
-		tree.freeMap(pEval);
+		ctx.myFree("bvalidateContext_t::pEval", pEval);
 		json_delete(jInput);
 	}
 };
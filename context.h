@@ -32,6 +32,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <time.h>
 #include <unistd.h>
 #include <cstring>
@@ -309,10 +310,10 @@ struct context_t {
 		if (__nmemb == 0 || __size == 0)
 			return NULL;
 
-		// calculate and round size up to nearest 32 bytes
+		// calculate and round size up to nearest 64 bytes
 		__size *= __nmemb;
-		__size += 32;
-		__size &= ~31ULL;
+		__size += 64;
+		__size &= ~63ULL;
 
 		totalAllocated += __size;
 
@@ -320,9 +321,13 @@ struct context_t {
 		 * @date 2020-04-16 20:06:57
 		 *
 		 * AVX2 needs 32byte alignment
+		 *
+		 * @date 2022-03-13 20:18:40
+		 *
+		 * Cache lines are 64 bytes, allows nodes to never straddle lines
 		 */
 
-		void *ret = ::aligned_alloc(32, __size);
+		void *ret = ::aligned_alloc(64, __size);
 		if (ret == 0)
 			fatal("failed to allocate %lu bytes for \"%s\"\n", __size, name);
 
@@ -350,6 +355,86 @@ struct context_t {
 		::free(ptr);
 	}
 
+	/**
+	 * @date 2022-03-13 22:48:27
+	 *
+	 * Allocate zeroed memory that is materialised on first touch.
+	 * Intended for large sparse vectors (maps, indices) sized to the tree capacity of which only a fraction is used.
+	 * Only touched pages occupy physical memory.
+	 *
+	 * @param {string} name - Name associated to memory area
+	 * @param {number} __nmemb - Number of elements
+	 * @param {number} __size - Size of element
+	 * @return {void[]} - Pointer to memory area. Release with `myFreeLazy()`
+	 */
+	void *myAllocLazy(const char *name, size_t __nmemb, size_t __size) {
+		if (opt_verbose >= VERBOSE_INITIALIZE)
+			fprintf(stderr, "Allocating %s. %lu=%lu*%lu\n", name, __nmemb * __size, __nmemb, __size);
+
+		if (__nmemb == 0 || __size == 0)
+			return NULL;
+
+		__size *= __nmemb;
+
+		totalAllocated += __size;
+
+		// anonymous mappings are zero-filled and page aligned
+		void *ret = ::mmap(NULL, __size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		if (ret == MAP_FAILED)
+			fatal("failed to map %lu bytes for \"%s\": %m\n", __size, name);
+
+		if (opt_verbose >= VERBOSE_INITIALIZE)
+			fprintf(stderr, "memory +%p %s\n", ret, name);
+
+		return ret;
+	}
+
+	/**
+	 * @date 2022-03-13 22:48:33
+	 *
+	 * Release memory allocated by `myAllocLazy()`
+	 *
+	 * @param {string} name - Name associated to memory area. Should match that of `myAllocLazy()`
+	 * @param {void[]} ptr - Pointer to memory area to be released
+	 * @param {number} __nmemb - Number of elements, as passed to `myAllocLazy()`
+	 * @param {number} __size - Size of element, as passed to `myAllocLazy()`
+	 */
+	void myFreeLazy(const char *name, void *ptr, size_t __nmemb, size_t __size) {
+		if (opt_verbose >= VERBOSE_INITIALIZE)
+			fprintf(stderr, "memory -%p %s\n", ptr, name);
+
+		if (ptr && ::munmap(ptr, __nmemb * __size))
+			fatal("munmap() returned: %m\n");
+	}
+
+	/**
+	 * @date 2022-03-13 22:48:41
+	 *
+	 * Zero a memory area allocated by `myAllocLazy()`.
+	 * Whole pages are returned to the system and re-materialise as zero on next touch,
+	 * cost is proportional to the pages that were actually touched.
+	 *
+	 * @param {void[]} ptr - Start of area
+	 * @param {number} __len - Length in bytes
+	 */
+	static void myClearLazy(void *ptr, size_t __len) {
+		const uintptr_t pageSize = (uintptr_t) ::sysconf(_SC_PAGESIZE);
+		uintptr_t       lo       = (uintptr_t) ptr;
+		uintptr_t       hi       = lo + __len;
+		uintptr_t       pageLo   = (lo + pageSize - 1) & ~(pageSize - 1);
+		uintptr_t       pageHi   = hi & ~(pageSize - 1);
+
+		if (pageLo >= pageHi || ::madvise((void *) pageLo, pageHi - pageLo, MADV_DONTNEED) != 0) {
+			// too small or not pageable
+			::memset(ptr, 0, __len);
+			return;
+		}
+
+		// partial pages at the edges
+		::memset(ptr, 0, pageLo - lo);
+		::memset((void *) pageHi, 0, hi - pageHi);
+	}
+
         /*
          * Prime numbers
          */
@@ -610,4 +695,44 @@ struct context_t {
 
 };
 
+/**
+ * @date 2022-03-14 00:10:12
+ *
+ * Bounded output buffer with the `+=` interface of `std::string`.
+ * Allows notation to be streamed to a file instead of being collected in memory first.
+ */
+struct streamWriter_t {
+	/// @var {context_t} I/O context
+	context_t &ctx;
+	/// @var {FILE} output stream
+	FILE      *outf;
+	/// @var {number} number of pending characters
+	size_t    len;
+	/// @var {char[]} pending characters
+	char      buf[65536];
+
+	streamWriter_t(context_t &ctx, FILE *outf) : ctx(ctx), outf(outf), len(0) {
+	}
+
+	~streamWriter_t() {
+		flush();
+	}
+
+	inline streamWriter_t &operator+=(char ch) {
+		if (len == sizeof buf)
+			flush();
+		buf[len++] = ch;
+		return *this;
+	}
+
+	/*
+	 * Write pending characters
+	 */
+	void flush(void) {
+		if (len && fwrite(buf, len, 1, outf) != 1)
+			ctx.fatal("fwrite() returned: %m\n");
+		len = 0;
+	}
+};
+
 #endif
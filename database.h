@@ -84,6 +84,17 @@
 // NOTE: with next version, reposition `magic_sidCRC`
 // NOTE: with next version, add `idFirst`
 
+/**
+ * @date 2022-03-13 21:33:05
+ *
+ * Number of entries (power of 2) in the direct-mapped cache of compiled member names.
+ *
+ * @constant {number} DATABASE_MEMBERCODECACHE
+ */
+#if !defined(DATABASE_MEMBERCODECACHE)
+#define DATABASE_MEMBERCODECACHE 65536
+#endif
+
 /*
  *  All components contributing and using the database should share the same dimensions
  */
@@ -262,6 +273,9 @@ struct database_t {
 	signature_t     *signatures;                 // signature collection
 	uint32_t        signatureIndexSize;          // index size (must be prime)
 	uint32_t        *signatureIndex;             // index
+	uint32_t        numSignatureCode;            // number of compiled signatures
+	uint32_t        maxSignatureCode;            // maximum size of compiled collection
+	signatureCode_t *signatureCodes;             // compiled signature names, allocated on demand by `compileSignatures()`
 	// swap store
 	uint32_t        numSwap;                     // number of swaps
 	uint32_t        maxSwap;                     // maximum size of collection
@@ -288,6 +302,8 @@ struct database_t {
 	member_t        *members;                    // member collection
 	uint32_t        memberIndexSize;             // index size (must be prime)
 	uint32_t        *memberIndex;                // index
+	uint32_t        *memberCodeTags;             // mid of cached compiled member, 0 if empty
+	signatureCode_t *memberCodes;                // cache of compiled member names, see `lookupMemberCode()`
 	// patternFirst store
 	uint32_t        numPatternFirst;             // number of patternsFirst
 	uint32_t        maxPatternFirst;             // maximum size of collection
@@ -339,6 +355,9 @@ struct database_t {
 		signatures         = NULL;
 		signatureIndexSize = 0;
 		signatureIndex     = NULL;
+		numSignatureCode   = 0;
+		maxSignatureCode   = 0;
+		signatureCodes     = NULL;
 
 		// swap store
 		numSwap       = 0;
@@ -369,6 +388,8 @@ struct database_t {
 		members         = NULL;
 		memberIndexSize = 0;
 		memberIndex     = NULL;
+		memberCodeTags  = NULL;
+		memberCodes     = NULL;
 
 		// patternFirst store
 		numPatternFirst       = 0;
@@ -419,6 +440,8 @@ struct database_t {
 			ctx.myFree("database_t::signatures", signatures);
 		if (allocFlags & ALLOCMASK_SIGNATUREINDEX)
 			ctx.myFree("database_t::signatureIndex", signatureIndex);
+		if (signatureCodes)
+			ctx.myFree("database_t::signatureCodes", signatureCodes);
 		if (allocFlags & ALLOCMASK_SWAP)
 			ctx.myFree("database_t::swaps", swaps);
 		if (allocFlags & ALLOCMASK_SWAPINDEX)
@@ -435,6 +458,10 @@ struct database_t {
 			ctx.myFree("database_t::members", members);
 		if (allocFlags & ALLOCMASK_MEMBERINDEX)
 			ctx.myFree("database_t::memberIndex", memberIndex);
+		if (memberCodes) {
+			ctx.myFree("database_t::memberCodeTags", memberCodeTags);
+			ctx.myFree("database_t::memberCodes", memberCodes);
+		}
 		if (allocFlags & ALLOCMASK_PATTERNFIRST)
 			ctx.myFree("database_t::patternsFirst", patternsFirst);
 		if (allocFlags & ALLOCMASK_PATTERNFIRSTINDEX)
@@ -1980,6 +2007,162 @@ struct database_t {
 		return (uint32_t) (pSignature - this->signatures);
 	}
 
+	/**
+	 * @date 2022-03-13 18:36:02
+	 *
+	 * Compile a signature name into `Q?T:F` instructions.
+	 *
+	 * @date 2022-03-13 21:30:48
+	 * Optional `pTransform` is applied to endpoints, for member names
+	 *
+	 * @param {string} pName - signature name
+	 * @param {signatureCode_t} pCode - output
+	 * @param {string} pTransform - optional endpoint transform
+	 */
+	void compileSignature(const char *pName, signatureCode_t *pCode, const char *pTransform = NULL) {
+		uint8_t  stack[signature_t::SIGNATURENAMELENGTH]; // operand stack
+		unsigned numStack = 0;
+		unsigned numCode  = 0;
+
+		for (const char *pattern = pName; *pattern; pattern++) {
+			uint8_t Q, T, F;
+
+			switch (*pattern) {
+			case '0':
+				stack[numStack++] = 0;
+				continue; // for
+
+				// @formatter:off
+			case '1': case '2': case '3':
+			case '4': case '5': case '6':
+			case '7': case '8': case '9':
+				// @formatter:on
+				assert((unsigned) (*pattern - '0') <= numCode);
+				stack[numStack++] = signatureCode_t::REG_NODE + numCode - (*pattern - '0');
+				continue; // for
+
+				// @formatter:off
+			case 'a': case 'b': case 'c':
+			case 'd': case 'e': case 'f':
+			case 'g': case 'h': case 'i':
+				// @formatter:on
+				if (pTransform)
+					stack[numStack++] = 1 + (pTransform[*pattern - 'a'] - 'a');
+				else
+					stack[numStack++] = 1 + (*pattern - 'a');
+				continue; // for
+
+			case '+': // OR
+				F = stack[--numStack];
+				Q = stack[--numStack];
+				T = 0 | signatureCode_t::T_INVERT;
+				break;
+			case '>': // GT
+				T = stack[--numStack];
+				Q = stack[--numStack];
+				T |= signatureCode_t::T_INVERT;
+				F = 0;
+				break;
+			case '^': // XOR/NE
+				F = stack[--numStack];
+				Q = stack[--numStack];
+				T = F | signatureCode_t::T_INVERT;
+				break;
+			case '!': // QnTF
+				F = stack[--numStack];
+				T = stack[--numStack];
+				Q = stack[--numStack];
+				T |= signatureCode_t::T_INVERT;
+				break;
+			case '&': // AND
+				T = stack[--numStack];
+				Q = stack[--numStack];
+				F = 0;
+				break;
+			case '?': // QTF
+				F = stack[--numStack];
+				T = stack[--numStack];
+				Q = stack[--numStack];
+				break;
+			default:
+				ctx.fatal("\n{\"error\":\"bad token\",\"where\":\"%s:%s:%d\",\"name\":\"%s\"}\n", __FUNCTION__, __FILE__, __LINE__, pName);
+			}
+
+			if (numCode >= signatureCode_t::MAXCODE)
+				ctx.fatal("\n{\"error\":\"signature too large\",\"where\":\"%s:%s:%d\",\"name\":\"%s\"}\n", __FUNCTION__, __FILE__, __LINE__, pName);
+
+			pCode->code[numCode].Q = Q;
+			pCode->code[numCode].T = T;
+			pCode->code[numCode].F = F;
+			stack[numStack++] = signatureCode_t::REG_NODE + numCode++;
+		}
+
+		// empty names (reserved entries) evaluate to zero
+		assert(numStack <= 1);
+		pCode->numCode = numCode;
+		pCode->root    = numStack ? stack[0] : 0;
+	}
+
+	/**
+	 * @date 2022-03-13 18:41:27
+	 *
+	 * Compile all signatures added since last call.
+	 * Compiled signatures are not stored in the database file and are only needed by evaluators.
+	 */
+	void compileSignatures(void) {
+		if (this->numSignatureCode == this->numSignature)
+			return;
+
+		if (this->maxSignatureCode < this->numSignature) {
+			uint32_t        newMax  = this->maxSignature > this->numSignature ? this->maxSignature : this->numSignature;
+			signatureCode_t *pCodes = (signatureCode_t *) ctx.myAlloc("database_t::signatureCodes", newMax, sizeof *pCodes);
+
+			if (this->signatureCodes) {
+				::memcpy(pCodes, this->signatureCodes, this->numSignatureCode * sizeof *pCodes);
+				ctx.myFree("database_t::signatureCodes", this->signatureCodes);
+			}
+
+			this->signatureCodes   = pCodes;
+			this->maxSignatureCode = newMax;
+		}
+
+		for (uint32_t iSid = this->numSignatureCode; iSid < this->numSignature; iSid++)
+			compileSignature(this->signatures[iSid].name, this->signatureCodes + iSid);
+
+		this->numSignatureCode = this->numSignature;
+	}
+
+	/**
+	 * @date 2022-03-13 21:37:19
+	 *
+	 * Get the compiled member name with its transform applied.
+	 * Members are too numerous to compile all, compiled names are kept in a direct-mapped cache.
+	 * NOTE: returned entry may be evicted by the next call
+	 *
+	 * @param {number} mid - member id
+	 * @return {signatureCode_t} compiled member
+	 */
+	const signatureCode_t *lookupMemberCode(uint32_t mid) {
+		assert(mid != 0 && mid < this->numMember);
+
+		if (this->memberCodes == NULL) {
+			this->memberCodeTags = (uint32_t *) ctx.myAlloc("database_t::memberCodeTags", DATABASE_MEMBERCODECACHE, sizeof *memberCodeTags);
+			this->memberCodes    = (signatureCode_t *) ctx.myAlloc("database_t::memberCodes", DATABASE_MEMBERCODECACHE, sizeof *memberCodes);
+		}
+
+		unsigned        ix     = mid & (DATABASE_MEMBERCODECACHE - 1);
+		signatureCode_t *pCode = this->memberCodes + ix;
+
+		if (this->memberCodeTags[ix] != mid) {
+			const member_t *pMember = this->members + mid;
+
+			compileSignature(pMember->name, pCode, this->revTransformNames[pMember->tid]);
+			this->memberCodeTags[ix] = mid;
+		}
+
+		return pCode;
+	}
+
 	/*
 	 * Swap store
 	 */
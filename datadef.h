@@ -236,6 +236,35 @@ struct signature_t {
 	fold_t foldsNZ[MAXSLOTS];
 };
 
+/*
+ * @date 2022-03-13 18:20:11
+ *
+ * Signature name compiled to a flat list of `Q?T:F` instructions.
+ * Operands are registers: `0` is node 0 (zero), `1..MAXSLOTS` are the slots, followed by the results of the instructions.
+ * Back-references are resolved to registers, leaving evaluators a loop without parsing.
+ */
+struct signatureCode_t {
+	enum {
+		/// @constant {number} Maximum number of instructions. Each node needs an operator and a pushed operand
+		MAXCODE  = signature_t::SIGNATURENAMELENGTH / 2,
+		/// @constant {number} First register holding an instruction result
+		REG_NODE = 1 + MAXSLOTS,
+		/// @constant {number} `T` operand is inverted
+		T_INVERT = 0x80,
+	};
+
+	/// @var {number} number of instructions
+	uint8_t numCode;
+
+	/// @var {number} register containing the result
+	uint8_t root;
+
+	/// @var {number[]} instructions, `T` may be flagged with `T_INVERT`
+	struct {
+		uint8_t Q, T, F;
+	} code[MAXCODE];
+};
+
 /*
  * @date 2020-05-04 13:14:11
  *
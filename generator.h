@@ -80,9 +80,14 @@
  */
 
 #include <assert.h>
+#include <signal.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "tinytree.h"
 
 /*
@@ -215,6 +220,9 @@ struct generator_t {
 	/// @var {number} Node depth at which to handle restart tabs.
 	unsigned restartTabDepth;
 
+	/// @var {FILE} `generateTasks()` worker output, NULL when not a worker
+	FILE *pTaskFile;
+
 	/// @var {number[]} template data for generator
 	uint32_t *pTemplateData;
 
@@ -242,6 +250,7 @@ struct generator_t {
 		windowLo = 0;
 		windowHi = 0;
 		pRestartData = NULL;
+		pTaskFile = NULL;
 		ctx.tick = 0;
 		restartTabDepth = GENERATOR_NSTART + 2; // for `7n9` +3 is a better choice. But `7n9-pure` still has 70177 restart tabs.
 
@@ -1036,9 +1045,11 @@ struct generator_t {
 			} else if (ctx.opt_debug & ctx.DEBUGMASK_GENERATOR_TABS) {
 				/*
 				 * Hit a restart tab, intended for `genrestartdata`
+				 * Returning `false` skips the tab, which is used to count/isolate tabs.
 				 */
 				foundTree.root = 0;
-				(*cbObject.*cbMember)(foundTree, "", 0, 0, 0);
+				if (!(*cbObject.*cbMember)(foundTree, "", 0, 0, 0))
+					return;
 			}
 		}
 
@@ -1071,6 +1082,290 @@ struct generator_t {
 		}
 	}
 
+	/**
+	 * @date 2022-03-10 20:31:46
+	 *
+	 * Typedefs of callback functions for `generateTasks()`
+	 *
+	 * `generateTaskCallback_t` is called by a worker after each task.
+	 * It can append counters/trailers to the task output in `pTaskFile`.
+	 *
+	 * `mergeTaskCallback_t` is called by the parent, in `progress` order, to replay the output of a task.
+	 * `f` is positioned at the start of the output and `length` is the number of bytes written by the worker.
+	 * Return `false` to stop (like on database overflow).
+	 */
+	typedef void(callable_t::* generateTaskCallback_t)(FILE *f);
+	typedef bool(callable_t::* mergeTaskCallback_t)(FILE *f, uint64_t length);
+
+	/*
+	 * @date 2022-03-10 20:44:13
+	 *
+	 * Task administration, shared between parent and workers
+	 */
+	struct generatorTask_t {
+		uint64_t windowLo;   // progress lower bound
+		uint64_t windowHi;   // progress upper bound, zero for open-ended
+		uint64_t progress;   // progress when task completed
+		uint64_t offset;     // start of output in worker file
+		uint64_t length;     // length of output
+		uint64_t cntHash;    // `ctx.cntHash` delta
+		uint64_t cntCompare; // `ctx.cntCompare` delta
+		uint32_t worker;     // worker that ran the task
+		uint32_t done;       // task completed
+	};
+
+	/**
+	 * @date 2022-03-10 21:02:58
+	 *
+	 * Run `generateTrees()` with `numJobs` worker processes.
+	 *
+	 * Each restart tab within the `--window` becomes a task.
+	 * Tabs vary wildly in cost, so instead of static windows workers grab the next available task from a shared counter.
+	 * Workers run `cbFound` which should write its results to `pTaskFile` instead of updating shared resources.
+	 * The parent replays the task outputs with `cbMerge`, in task (and thus `progress`) order, as soon as they become available.
+	 * Outcome is identical to a single process run.
+	 *
+	 * Workers are `fork()`ed and share the read-only state of the caller (like the database) copy-on-write.
+	 * Each worker has its own private `generator_t` and `tinyTree_t` state.
+	 *
+	 * Without restart data, or with a single job, it falls back to a regular `generateTrees()` in the current process.
+	 *
+	 * NOTE: caller sets `windowLo`, `windowHi`, `pRestartData` and calls `initialiseGenerator()` as it would for `generateTrees()`.
+	 *
+	 * @param {number} numJobs - number of worker processes
+	 * @param {number} numNodes - tree size in nodes
+	 * @param {object} cbObject - callback object
+	 * @param {object} cbFound - `foundTree()` callback, runs in worker
+	 * @param {object} cbTask - end of task callback, runs in worker, may be NULL
+	 * @param {object} cbMerge - replay callback, runs in parent
+	 */
+	void generateTasks(unsigned numJobs, unsigned numNodes, callable_t *cbObject, generateTreeCallback_t cbFound, generateTaskCallback_t cbTask, mergeTaskCallback_t cbMerge) {
+		unsigned endpointsLeft = numNodes * 2 + 1;
+
+		/*
+		 * Determine tasks, one per restart tab overlapping the window
+		 */
+		unsigned numTabs = 0;
+
+		if (this->pRestartData && numJobs > 1) {
+			for (const uint64_t *p = this->pRestartData; *p != 0xffffffffffffffffLL; p++)
+				numTabs++;
+		}
+
+		generatorTask_t *pTasks = NULL;
+		unsigned        numTasks = 0;
+
+		if (numTabs > 1) {
+			pTasks = (generatorTask_t *) ::mmap(NULL, (numTabs + 1) * sizeof(*pTasks), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+			if (pTasks == MAP_FAILED)
+				ctx.fatal("\n{\"error\":\"mmap() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+		}
+
+		// entry 0 holds the shared task counter
+		uint64_t        *pNextTask = pTasks ? &pTasks->progress : NULL;
+		generatorTask_t *pTask     = pTasks ? pTasks + 1 : NULL;
+
+		for (unsigned iTab = 0; iTab < numTabs; iTab++) {
+			uint64_t lo = this->pRestartData[iTab];
+			uint64_t hi = (iTab + 1 < numTabs) ? this->pRestartData[iTab + 1] : 0;
+
+			// clip to window
+			if (hi && hi <= this->windowLo)
+				continue;
+			if (this->windowHi && lo >= this->windowHi)
+				break;
+			if (lo < this->windowLo)
+				lo = this->windowLo;
+			if (this->windowHi && (hi == 0 || hi > this->windowHi))
+				hi = this->windowHi;
+
+			pTask[numTasks].windowLo = lo;
+			pTask[numTasks].windowHi = hi;
+			numTasks++;
+		}
+
+		if (numTasks < 2) {
+			// single process
+			if (pTasks)
+				::munmap((void *) pTasks, (numTabs + 1) * sizeof(*pTasks));
+
+			clearGenerator();
+			generateTrees(numNodes, endpointsLeft, 0, 0, cbObject, cbFound);
+			return;
+		}
+
+		if (numJobs > numTasks)
+			numJobs = numTasks;
+
+		/*
+		 * Create worker outputs.
+		 * The parent needs an independent file offset, so open by name before unlinking.
+		 */
+		int  *pJobFd   = (int *) ctx.myAlloc("generator_t::pJobFd", numJobs, sizeof(*pJobFd));
+		FILE **pJobIn  = (FILE **) ctx.myAlloc("generator_t::pJobIn", numJobs, sizeof(*pJobIn));
+		pid_t *pJobPid = (pid_t *) ctx.myAlloc("generator_t::pJobPid", numJobs, sizeof(*pJobPid));
+
+		for (unsigned iJob = 0; iJob < numJobs; iJob++) {
+			char name[64];
+			sprintf(name, "%s/untangle-XXXXXX", P_tmpdir);
+
+			pJobFd[iJob] = ::mkstemp(name);
+			if (pJobFd[iJob] < 0)
+				ctx.fatal("\n{\"error\":\"mkstemp() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+			pJobIn[iJob] = ::fopen(name, "r");
+			if (pJobIn[iJob] == NULL)
+				ctx.fatal("\n{\"error\":\"fopen('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  name, __FUNCTION__, __FILE__, __LINE__);
+			::unlink(name);
+		}
+
+		// workers announce completed tasks
+		int hPipe[2];
+		if (::pipe(hPipe) != 0)
+			ctx.fatal("\n{\"error\":\"pipe() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		// avoid buffered output being duplicated by workers
+		fflush(stdout);
+		fflush(stderr);
+
+		/*
+		 * Start workers
+		 */
+		const uint64_t *pRestartStart = this->pRestartData;
+
+		for (unsigned iJob = 0; iJob < numJobs; iJob++) {
+			pJobPid[iJob] = ::fork();
+			if (pJobPid[iJob] < 0)
+				ctx.fatal("\n{\"error\":\"fork() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+
+			if (pJobPid[iJob] == 0) {
+				/*
+				 * Worker
+				 */
+				::close(hPipe[0]);
+				this->pTaskFile = ::fdopen(pJobFd[iJob], "w");
+				if (this->pTaskFile == NULL)
+					ctx.fatal("\n{\"error\":\"fdopen() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__);
+
+				uint64_t offset = 0;
+
+				for (;;) {
+					// grab next task
+					uint32_t iNext = (uint32_t) __sync_fetch_and_add(pNextTask, 1);
+					if (iNext >= numTasks)
+						break;
+
+					generatorTask_t *pCurr = pTask + iNext;
+
+					uint64_t cntHash    = ctx.cntHash;
+					uint64_t cntCompare = ctx.cntCompare;
+
+					// restart generator
+					this->windowLo     = pCurr->windowLo;
+					this->windowHi     = pCurr->windowHi;
+					this->pRestartData = pRestartStart;
+					ctx.progress       = 0;
+					ctx.tick           = 0;
+
+					clearGenerator();
+					generateTrees(numNodes, endpointsLeft, 0, 0, cbObject, cbFound);
+
+					if (cbTask)
+						(*cbObject.*cbTask)(this->pTaskFile);
+
+					if (::fflush(this->pTaskFile) != 0)
+						ctx.fatal("\n{\"error\":\"fflush() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+							  __FUNCTION__, __FILE__, __LINE__);
+
+					uint64_t end = (uint64_t) ::ftell(this->pTaskFile);
+
+					pCurr->progress   = ctx.progress;
+					pCurr->offset     = offset;
+					pCurr->length     = end - offset;
+					pCurr->cntHash    = ctx.cntHash - cntHash;
+					pCurr->cntCompare = ctx.cntCompare - cntCompare;
+					pCurr->worker     = iJob;
+					offset = end;
+
+					// announce
+					if (::write(hPipe[1], &iNext, sizeof(iNext)) != sizeof(iNext))
+						ctx.fatal("\n{\"error\":\"write() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+							  __FUNCTION__, __FILE__, __LINE__);
+				}
+
+				// do not run destructors or `atexit()` handlers
+				::_exit(0);
+			}
+		}
+
+		// parent only reads
+		::close(hPipe[1]);
+		for (unsigned iJob = 0; iJob < numJobs; iJob++)
+			::close(pJobFd[iJob]);
+
+		/*
+		 * Merge task outputs in order
+		 */
+		bool stopped = false;
+
+		for (unsigned iTask = 0; iTask < numTasks; iTask++) {
+			// wait until task available
+			while (!pTask[iTask].done) {
+				uint32_t iDone;
+
+				if (::read(hPipe[0], &iDone, sizeof(iDone)) != sizeof(iDone))
+					ctx.fatal("\n{\"error\":\"worker failed\",\"where\":\"%s:%s:%d\",\"task\":%u}\n",
+						  __FUNCTION__, __FILE__, __LINE__, iTask);
+				pTask[iDone].done = 1;
+			}
+
+			generatorTask_t *pCurr = pTask + iTask;
+			FILE            *f     = pJobIn[pCurr->worker];
+
+			::fseek(f, (long) pCurr->offset, SEEK_SET);
+
+			ctx.cntHash += pCurr->cntHash;
+			ctx.cntCompare += pCurr->cntCompare;
+
+			if (!(*cbObject.*cbMerge)(f, pCurr->length)) {
+				stopped = true;
+				break;
+			}
+
+			ctx.progress = pCurr->progress;
+		}
+
+		/*
+		 * Cleanup
+		 */
+		for (unsigned iJob = 0; iJob < numJobs; iJob++) {
+			int status;
+
+			if (stopped)
+				::kill(pJobPid[iJob], SIGKILL);
+			if (::waitpid(pJobPid[iJob], &status, 0) != pJobPid[iJob])
+				ctx.fatal("\n{\"error\":\"waitpid() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+			if (!stopped && (!WIFEXITED(status) || WEXITSTATUS(status) != 0))
+				ctx.fatal("\n{\"error\":\"worker failed\",\"where\":\"%s:%s:%d\",\"job\":%u,\"status\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, iJob, status);
+
+			::fclose(pJobIn[iJob]);
+		}
+
+		::close(hPipe[0]);
+		::munmap((void *) pTasks, (numTabs + 1) * sizeof(*pTasks));
+
+		ctx.myFree("generator_t::pJobFd", pJobFd);
+		ctx.myFree("generator_t::pJobIn", pJobIn);
+		ctx.myFree("generator_t::pJobPid", pJobPid);
+	}
+
 };
 
 #endif
@@ -246,6 +246,8 @@ struct genmemberContext_t : dbtool_t {
 	unsigned   opt_force;
 	/// @var {number} Invoke generator for new candidates
 	unsigned   opt_generate;
+	/// @var {number} --jobs, number of worker processes for generator
+	unsigned   opt_jobs;
 	/// @var {string} let `findHeadTail()` show what is missing instead of failing
 	unsigned   opt_listLookup;
 	/// @var {string} name of file containing members
@@ -298,6 +300,39 @@ struct genmemberContext_t : dbtool_t {
 	uint64_t    truncated;
 	/// @var {number} Name of signature causing overflow
 	char        truncatedName[tinyTree_t::TINYTREE_NAMELEN + 1];
+	/// @var {number} `mergeMember()`, sid/tid found by worker. Zero to lookup
+	uint32_t    mergeSid;
+	uint32_t    mergeTid;
+	/// @var {number} `--jobs` worker, `numEmpty`/`numUnsafe` at end of previous task
+	unsigned    taskNumEmpty;
+	unsigned    taskNumUnsafe;
+
+	/*
+	 * @date 2022-03-11 00:12:35
+	 *
+	 * Candidate as emitted by a `--jobs` worker after filtering and associative lookup
+	 */
+	struct taskRecord_t {
+		uint64_t progress;
+		uint32_t sid;
+		uint32_t tid;
+		uint8_t  numPlaceholder;
+		uint8_t  numEndpoint;
+		uint8_t  numBackRef;
+		char     name[tinyTree_t::TINYTREE_NAMELEN + 1];
+	};
+
+	/*
+	 * Worker counters, to be accumulated by the parent
+	 */
+	struct taskTrailer_t {
+		uint32_t skipDuplicate;
+		uint32_t skipSize;
+		uint32_t skipUnsafe;
+		uint32_t skipCascade;
+		int32_t  numEmpty;  // change since previous task
+		int32_t  numUnsafe; // change since previous task
+	};
 
 	/**
 	 * Constructor
@@ -310,6 +345,7 @@ struct genmemberContext_t : dbtool_t {
 		opt_altgen         = 0;
 		opt_force          = 0;
 		opt_generate       = 1;
+		opt_jobs           = 0;
 		opt_taskId         = 0;
 		opt_taskLast       = 0;
 		opt_listLookup     = 0;
@@ -335,6 +371,10 @@ struct genmemberContext_t : dbtool_t {
 		skipUnsafe       = 0;
 		truncated        = 0;
 		truncatedName[0] = 0;
+		mergeSid         = 0;
+		mergeTid         = 0;
+		taskNumEmpty     = 0;
+		taskNumUnsafe    = 0;
 	}
 
 	/*
@@ -915,10 +955,13 @@ struct genmemberContext_t : dbtool_t {
 
 		/*
 		 * test  for duplicates
+		 * NOTE: `--jobs` workers have a snapshot of the database, leave it to `mergeMember()`
 		 */
 
-		uint32_t mix = pStore->lookupMember(pNameR);
-		if (pStore->memberIndex[mix] != 0) {
+		uint32_t mix         = pStore->lookupMember(pNameR);
+		bool     isDuplicate = (pStore->memberIndex[mix] != 0);
+
+		if (isDuplicate && !generator.pTaskFile) {
 			// duplicate candidate name
 			skipDuplicate++;
 			return true;
@@ -927,7 +970,7 @@ struct genmemberContext_t : dbtool_t {
 		/*
 		 * Test for database overflow
 		 */
-		if (this->opt_truncate) {
+		if (this->opt_truncate && !generator.pTaskFile) {
 			// avoid `"storage full"`. Give warning later
 			if (pStore->maxPair - pStore->numPair <= 3 || pStore->maxMember - pStore->numMember <= 1) {
 				// break now, display text later/ Leave progress untouched
@@ -955,7 +998,8 @@ struct genmemberContext_t : dbtool_t {
 				area = MIXED;
 
 			// with `--mixed`, only accept PURE/MIXED
-			if (area == FULL)
+			// `--jobs` workers forward snapshot duplicates as members may be released, the parent counts them
+			if (area == FULL && !(isDuplicate && generator.pTaskFile))
 				return true;
 		}
 
@@ -1002,6 +1046,42 @@ struct genmemberContext_t : dbtool_t {
 		unsigned tid     = 0;
 		unsigned markSid = pStore->numSignature;
 
+		if (generator.pTaskFile) {
+			/*
+			 * `--jobs` worker, only perform the associative lookup.
+			 * Imprints are static, so not-found candidates can be dropped here.
+			 * With add-if-not-found, leave everything to the parent.
+			 *
+			 * @date 2022-03-12 19:02:16
+			 * Names already in the snapshot are most likely duplicates.
+			 * Members might be released in the meantime, so pass them with `sid=0` and let the parent decide/lookup.
+			 */
+			if (!isDuplicate && (!(ctx.flags & context_t::MAGICMASK_AINF) || this->readOnlyMode)) {
+				pStore->lookupImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
+				if (sid == 0)
+					return true; // not found
+
+				treeR.loadStringSafe(pNameR);
+				if (strcmp(treeR.saveString(treeR.root), pNameR) != 0)
+					return true; // see below
+			}
+
+			taskRecord_t rec;
+
+			rec.progress       = ctx.progress;
+			rec.sid            = sid;
+			rec.tid            = tid;
+			rec.numPlaceholder = numPlaceholder;
+			rec.numEndpoint    = numEndpoint;
+			rec.numBackRef     = numBackRef;
+			::strcpy(rec.name, pNameR);
+
+			if (::fwrite(&rec, sizeof(rec), 1, generator.pTaskFile) != 1)
+				ctx.fatal("\n{\"error\":\"fwrite() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+			return true;
+		}
+
 		if ((ctx.flags & context_t::MAGICMASK_AINF) && !this->readOnlyMode) {
 			/*
 			 * @date 2020-04-25 22:00:29
@@ -1013,6 +1093,10 @@ struct genmemberContext_t : dbtool_t {
 			 */
 			// add to imprints to index
 			sid = pStore->addImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, markSid);
+		} else if (this->mergeSid) {
+			// already looked up by `--jobs` worker
+			sid = this->mergeSid;
+			tid = this->mergeTid;
 		} else {
 			pStore->lookupImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
 		}
@@ -1545,6 +1629,84 @@ struct genmemberContext_t : dbtool_t {
 				skipDuplicate, skipSize, skipUnsafe, skipCascade);
 	}
 
+	/**
+	 * @date 2022-03-14 00:59:14
+	 *
+	 * `--jobs` worker: end of task, append counters to output
+	 *
+	 * @param {FILE} f - task output
+	 */
+	void taskMember(FILE *f) {
+		taskTrailer_t trailer;
+
+		trailer.skipDuplicate = skipDuplicate;
+		trailer.skipSize      = skipSize;
+		trailer.skipUnsafe    = skipUnsafe;
+		trailer.skipCascade   = skipCascade;
+		trailer.numEmpty      = (int32_t) (numEmpty - taskNumEmpty);
+		trailer.numUnsafe     = (int32_t) (numUnsafe - taskNumUnsafe);
+
+		if (::fwrite(&trailer, sizeof(trailer), 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"fwrite() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		// counters are per task
+		skipDuplicate = skipSize = skipUnsafe = skipCascade = 0;
+		taskNumEmpty  = numEmpty;
+		taskNumUnsafe = numUnsafe;
+	}
+
+	/**
+	 * @date 2022-03-11 00:25:03
+	 *
+	 * `--jobs` parent: replay the output of a task through `foundTreeMember()`.
+	 * Workers did the filtering and expensive associative lookups, the parent updates members in `progress` order.
+	 *
+	 * @param {FILE} f - task output
+	 * @param {number} length - size of task output
+	 * @return {boolean} `false` on database overflow
+	 */
+	bool mergeMember(FILE *f, uint64_t length) {
+		assert(length >= sizeof(taskTrailer_t) && (length - sizeof(taskTrailer_t)) % sizeof(taskRecord_t) == 0);
+
+		uint64_t   numRecord = (length - sizeof(taskTrailer_t)) / sizeof(taskRecord_t);
+		tinyTree_t tree(ctx);
+
+		for (uint64_t iRecord = 0; iRecord < numRecord; iRecord++) {
+			taskRecord_t rec;
+
+			if (::fread(&rec, sizeof(rec), 1, f) != 1)
+				ctx.fatal("\n{\"error\":\"fread() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+
+			ctx.progress = rec.progress;
+			tree.loadStringFast(rec.name);
+
+			this->mergeSid = rec.sid;
+			this->mergeTid = rec.tid;
+			bool ret = foundTreeMember(tree, rec.name, rec.numPlaceholder, rec.numEndpoint, rec.numBackRef);
+			this->mergeSid = 0;
+			this->mergeTid = 0;
+
+			if (!ret)
+				return false;
+		}
+
+		taskTrailer_t trailer;
+		if (::fread(&trailer, sizeof(trailer), 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"fread() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		skipDuplicate += trailer.skipDuplicate;
+		skipSize      += trailer.skipSize;
+		skipUnsafe    += trailer.skipUnsafe;
+		skipCascade   += trailer.skipCascade;
+		numEmpty      += trailer.numEmpty;
+		numUnsafe     += trailer.numUnsafe;
+
+		return true;
+	}
+
 	/**
 	 * @date 2020-03-22 01:00:05
 	 *
@@ -1578,8 +1740,8 @@ struct genmemberContext_t : dbtool_t {
 		generator.windowLo = this->opt_windowLo;
 		generator.windowHi = this->opt_windowHi;
 
-		// setup restart data, only for 5n9+
-		if (arg_numNodes > 4) {
+		// setup restart data, only for 5n9+ or when tasks are needed for `--jobs`
+		if (arg_numNodes > 4 || this->opt_jobs > 1) {
 			// walk through list
 			const metricsRestart_t *pRestart = getMetricsRestart(MAXSLOTS, arg_numNodes, ctx.flags & context_t::MAGICMASK_PURE);
 			// point to first entry if section present
@@ -1614,8 +1776,20 @@ struct genmemberContext_t : dbtool_t {
 			unsigned endpointsLeft = arg_numNodes * 2 + 1;
 
 			generator.initialiseGenerator();
-			generator.clearGenerator();
-			generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&genmemberContext_t::foundTreeMember));
+
+			if (this->opt_jobs > 1) {
+				// workers report changes relative to the state at fork
+				taskNumEmpty  = numEmpty;
+				taskNumUnsafe = numUnsafe;
+
+				generator.generateTasks(this->opt_jobs, arg_numNodes, this,
+							static_cast<generator_t::generateTreeCallback_t>(&genmemberContext_t::foundTreeMember),
+							static_cast<generator_t::generateTaskCallback_t>(&genmemberContext_t::taskMember),
+							static_cast<generator_t::mergeTaskCallback_t>(&genmemberContext_t::mergeMember));
+			} else {
+				generator.clearGenerator();
+				generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&genmemberContext_t::foundTreeMember));
+			}
 		}
 
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
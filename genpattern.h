@@ -74,6 +74,8 @@ struct genpatternContext_t : dbtool_t {
 	unsigned   opt_force;
 	/// @var {number} Invoke generator for new candidates
 	unsigned   opt_generate;
+	/// @var {number} --jobs, number of worker processes for generator
+	unsigned   opt_jobs;
 	/// @var {string} name of file containing patterns
 	const char *opt_load;
 	/// @var {string} --mixed, Consider/accept top-level mixed members only
@@ -117,6 +119,36 @@ struct genpatternContext_t : dbtool_t {
 	/// @var {number} Tid lookup table for endpoints and `lookupImprintAssociative()`
 	uint32_t    fastLookupTid[tinyTree_t::TINYTREE_NSTART];
 
+	/*
+	 * @date 2022-03-08 21:14:37
+	 *
+	 * Result of `foundTreePattern()` as emitted by a `--jobs` worker.
+	 * It holds the arguments of `addPatternToDatabase()`.
+	 * Task output is a list of records followed by a `taskTrailer_t`.
+	 */
+	struct taskRecord_t {
+		uint64_t progress;
+		uint32_t sidR;
+		uint32_t sidQ;
+		uint32_t tidQ;
+		uint32_t sidT;
+		uint32_t tidT;
+		uint32_t sidF;
+		uint32_t tidF;
+		uint32_t tidR;
+		int32_t  power;
+		char     name[tinyTree_t::TINYTREE_NAMELEN + 1];
+	};
+
+	/*
+	 * Worker counters, to be accumulated by the parent
+	 */
+	struct taskTrailer_t {
+		uint32_t skipWildcard;
+		uint32_t skipCollapse;
+		uint32_t skipPlaceholder;
+	};
+
 	/**
 	 * Constructor
 	 */
@@ -127,6 +159,7 @@ struct genpatternContext_t : dbtool_t {
 		arg_outputDatabase = NULL;
 		opt_force          = 0;
 		opt_generate       = 1;
+		opt_jobs           = 0;
 		opt_taskId         = 0;
 		opt_taskLast       = 0;
 		opt_load           = NULL;
@@ -179,6 +212,31 @@ struct genpatternContext_t : dbtool_t {
 		}
 	}
 
+	/*
+	 * @date 2022-03-14 00:55:40
+	 *
+	 * Test for database overflow when `--truncate` is active.
+	 * Called before adding a candidate, by `foundTreePattern()` or, with `--jobs`, by `mergePattern()`.
+	 * Workers have a snapshot of the database and leave the test to the parent.
+	 *
+	 * @param {string} pName - name of candidate about to be added
+	 * @return {boolean} `true` if truncated
+	 */
+	bool truncatePattern(const char *pName) {
+		if (!this->opt_truncate)
+			return false;
+
+		// avoid `"storage full"`. Give warning later
+		if (pStore->maxPatternFirst - pStore->numPatternFirst <= pStore->IDFIRST || pStore->maxPatternSecond - pStore->numPatternSecond <= pStore->IDFIRST) {
+			// break now, display text later/ Leave progress untouched
+			this->truncated = ctx.progress;
+			::strcpy(this->truncatedName, pName);
+			return true;
+		}
+
+		return false;
+	}
+
 	/*
 	 * Add the structure in `treeR` to the sid/tid detector dataset.
 	 *
@@ -248,17 +306,8 @@ struct genpatternContext_t : dbtool_t {
 		/*
 		 * Test for database overflow
 		 */
-		if (this->opt_truncate) {
-			// avoid `"storage full"`. Give warning later
-			if (pStore->maxPatternFirst - pStore->numPatternFirst <= pStore->IDFIRST || pStore->maxPatternSecond - pStore->numPatternSecond <= pStore->IDFIRST) {
-				// break now, display text later/ Leave progress untouched
-				this->truncated = ctx.progress;
-				::strcpy(this->truncatedName, pNameR);
-
-				// quit as fast as possible
-				return false;
-			}
-		}
+		if (!generator.pTaskFile && truncatePattern(pNameR))
+			return false; // quit as fast as possible
 
 		if (opt_mixed) {
 			enum {
@@ -589,6 +638,29 @@ struct genpatternContext_t : dbtool_t {
 		 * The structure in `treeR` has been identified as: sidR/tidR == sidQ/tidQ, sidT/tidT, sidF/tidF.
 		 */
 
+		if (generator.pTaskFile) {
+			// worker process, the parent updates the database
+			taskRecord_t rec;
+
+			rec.progress = ctx.progress;
+			rec.sidR     = sidR;
+			rec.sidQ     = sidQ;
+			rec.tidQ     = tidQ;
+			rec.sidT     = tlTi ? sidT ^ IBIT : sidT;
+			rec.tidT     = tidT;
+			rec.sidF     = sidF;
+			rec.tidF     = tidF;
+			rec.tidR     = tidR;
+			rec.power    = power;
+			::strncpy(rec.name, pNameR, sizeof(rec.name));
+			rec.name[sizeof(rec.name) - 1] = 0;
+
+			if (::fwrite(&rec, sizeof(rec), 1, generator.pTaskFile) != 1)
+				ctx.fatal("\n{\"error\":\"fwrite() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+			return true;
+		}
+
 		if (tlTi)
 			this->addPatternToDatabase(pNameR, sidR, sidQ, tidQ, sidT ^ IBIT, tidT, sidF, tidF, tidR, power);
 		else
@@ -1116,6 +1188,84 @@ struct genpatternContext_t : dbtool_t {
 
 	}
 
+	/**
+	 * @date 2022-03-08 21:40:05
+	 *
+	 * `--jobs` worker: end of task, append counters to output
+	 *
+	 * @param {FILE} f - task output
+	 */
+	void taskPattern(FILE *f) {
+		taskTrailer_t trailer;
+
+		trailer.skipWildcard    = skipWildcard;
+		trailer.skipCollapse    = skipCollapse;
+		trailer.skipPlaceholder = skipPlaceholder;
+
+		if (::fwrite(&trailer, sizeof(trailer), 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"fwrite() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		// counters are per task
+		skipWildcard = skipCollapse = skipPlaceholder = 0;
+	}
+
+	/**
+	 * @date 2022-03-08 21:52:30
+	 *
+	 * `--jobs` parent: replay the output of a task.
+	 * Workers do the generating, filtering and associative lookups, the parent only updates `patternFirst[]`/`patternSecond[]`.
+	 * Tasks are replayed in `progress` order making the outcome identical to a single process run.
+	 *
+	 * @param {FILE} f - task output
+	 * @param {number} length - size of task output
+	 * @return {boolean} `false` on database overflow
+	 */
+	bool /*__attribute__((optimize("O0")))*/ mergePattern(FILE *f, uint64_t length) {
+		assert(length >= sizeof(taskTrailer_t) && (length - sizeof(taskTrailer_t)) % sizeof(taskRecord_t) == 0);
+
+		uint64_t numRecord = (length - sizeof(taskTrailer_t)) / sizeof(taskRecord_t);
+
+		for (uint64_t iRecord = 0; iRecord < numRecord; iRecord++) {
+			taskRecord_t rec;
+
+			if (::fread(&rec, sizeof(rec), 1, f) != 1)
+				ctx.fatal("\n{\"error\":\"fread() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+
+			ctx.progress = rec.progress;
+
+			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
+				int perSecond = ctx.updateSpeed();
+
+				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% | numPatternFirst=%u(%.0f%%) numPatternSecond=%u(%.0f%%) | skipDuplicate=%u | hash=%.3f %s",
+					ctx.timeAsString(), ctx.progress, perSecond, (ctx.progress - generator.windowLo) * 100.0 / (ctx.progressHi - generator.windowLo),
+					pStore->numPatternFirst, pStore->numPatternFirst * 100.0 / pStore->maxPatternFirst,
+					pStore->numPatternSecond, pStore->numPatternSecond * 100.0 / pStore->maxPatternSecond,
+					skipDuplicate,
+					(double) ctx.cntCompare / ctx.cntHash, rec.name);
+
+				ctx.tick = 0;
+			}
+
+			if (truncatePattern(rec.name))
+				return false;
+
+			this->addPatternToDatabase(rec.name, rec.sidR, rec.sidQ, rec.tidQ, rec.sidT, rec.tidT, rec.sidF, rec.tidF, rec.tidR, rec.power);
+		}
+
+		taskTrailer_t trailer;
+		if (::fread(&trailer, sizeof(trailer), 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"fread() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		skipWildcard += trailer.skipWildcard;
+		skipCollapse += trailer.skipCollapse;
+		skipPlaceholder += trailer.skipPlaceholder;
+
+		return true;
+	}
+
 	/**
 	 * @date 2021-10-19 23:17:46
 	 *
@@ -1149,8 +1299,8 @@ struct genpatternContext_t : dbtool_t {
 		generator.windowLo = this->opt_windowLo;
 		generator.windowHi = this->opt_windowHi;
 
-		// setup restart data, only for 5n9+
-		if (arg_numNodes > 4) {
+		// setup restart data, only for 5n9+ or when tasks are needed for `--jobs`
+		if (arg_numNodes > 4 || this->opt_jobs > 1) {
 			// walk through list
 			const metricsRestart_t *pRestart = getMetricsRestart(MAXSLOTS, arg_numNodes, ctx.flags & context_t::MAGICMASK_PURE);
 			// point to first entry if section present
@@ -1181,6 +1331,12 @@ struct genpatternContext_t : dbtool_t {
 			foundTreePattern(tree, "0", 0, 0, 0);
 			tree.root = 1; // "a"
 			foundTreePattern(tree, "a", 1, 1, 0);
+		} else if (this->opt_jobs > 1) {
+			generator.initialiseGenerator();
+			generator.generateTasks(this->opt_jobs, arg_numNodes, this,
+						static_cast<generator_t::generateTreeCallback_t>(&genpatternContext_t::foundTreePattern),
+						static_cast<generator_t::generateTaskCallback_t>(&genpatternContext_t::taskPattern),
+						static_cast<generator_t::mergeTaskCallback_t>(&genpatternContext_t::mergePattern));
 		} else {
 			unsigned endpointsLeft = arg_numNodes * 2 + 1;
 
@@ -1192,7 +1348,7 @@ struct genpatternContext_t : dbtool_t {
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
 			fprintf(stderr, "\r\e[K");
 
-		if (ctx.progress != ctx.progressHi && this->opt_windowLo == 0 && this->opt_windowHi == 0) {
+		if (ctx.progress != ctx.progressHi && this->opt_windowLo == 0 && this->opt_windowHi == 0 && !this->truncated) {
 			// can only test if windowing is disabled
 			printf("{\"error\":\"progressHi failed\",\"where\":\"%s:%s:%d\",\"encountered\":%lu,\"expected\":%lu,\"numNode\":%u}\n",
 			       __FUNCTION__, __FILE__, __LINE__, ctx.progress, ctx.progressHi, arg_numNodes);
@@ -35,6 +35,13 @@
  *   The endpoints represent tree heads which can have arbitrary node ID's.
  *   And speed is still amazing:
  *     [2021-07-25 23:14:56] 907188280660(189953599/s) 58.30050% eta=0:56:55
+ *
+ * @date 2022-03-12 10:14:37
+ *
+ *   Relative restart points have been implemented.
+ *   Every restart tab is a task that counts the candidates below it, tasks are distributed over `--jobs` forked workers.
+ *   Absolute restart points are reconstructed by summing the counts of the preceding tabs.
+ *   With `--checkpoint=<file>` completed tasks are logged so an interrupted invocation can resume where it left off.
  */
 
 /*
@@ -60,6 +67,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 #include "tinytree.h"
@@ -86,6 +94,10 @@ struct genrestartdataContext_t : callable_t {
 	/// @var {number} size of structures used in this invocation
 	unsigned arg_numNodes;
 
+	/// @var {string} name of file logging completed tasks
+	const char *opt_checkpoint;
+	/// @var {number} number of worker processes
+	unsigned opt_jobs;
 	/// @var {number} task Id. First task=1
 	unsigned opt_taskId;
 	/// @var {number} Number of tasks / last task
@@ -94,6 +106,26 @@ struct genrestartdataContext_t : callable_t {
 	/// @var {number} Number of restart entries found
 	unsigned numRestart;
 
+	/**
+	 * @date 2022-03-12 10:31:05
+	 *
+	 * A single restart tab to count. `iTab==0` counts the whole section (sections without tabs).
+	 * `numProgress` is the number of candidates below the tab.
+	 */
+	struct restartTask_t {
+		uint32_t numArgs;
+		uint32_t iPure;
+		uint32_t iTab;
+		uint32_t done;
+		uint64_t numProgress;
+		char     name[tinyTree_t::TINYTREE_NEND * 4 + 1];
+	};
+
+	/// @var {restartTask_t[]} task list, shared with workers. Entry 0 holds the next task counter
+	restartTask_t *pTasks;
+	/// @var {number} number of tasks (excluding entry 0)
+	unsigned numTasks;
+
 	/// @var {number} - THE generator
 	generator_t generator;
 
@@ -104,10 +136,14 @@ struct genrestartdataContext_t : callable_t {
 		// arguments and options
 		arg_numNodes = 0;
 
-		opt_taskId   = 0;
-		opt_taskLast = 0;
+		opt_checkpoint = NULL;
+		opt_jobs       = 0;
+		opt_taskId     = 0;
+		opt_taskLast   = 0;
 
 		numRestart = 0;
+		pTasks     = NULL;
+		numTasks   = 0;
 	}
 
 	/**
@@ -168,8 +204,7 @@ struct genrestartdataContext_t : callable_t {
 	 * @param {number} numBackRef - number of back-references
 	 * @return {boolean} return `true` to continue with recursion (this should be always the case except for `genrestartdata`)
 	 */
-	bool foundTreeFilterTab(const generator_t &tree, const char *pName, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
-
+	bool foundTreeFilterTab(tinyTree_t &noname, const char *pName, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
 
 		/*
 		 * numRestart start at zero, opt_taskId at 1
@@ -221,20 +256,13 @@ struct genrestartdataContext_t : callable_t {
 	}
 
 	/**
-	 * @date 2020-04-16 10:10:46
+	 * @date 2022-03-12 10:38:51
 	 *
-	 * Found restart tab, Output restart entry
+	 * Construct display name of the restart tab the generator is currently at
 	 *
-	 * @param {generatorTree_t} tree - candidate tree
-	 * @param {string} pName - tree notation/name
-	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
-	 * @param {number} numEndpoint - number of non-zero endpoints in tree
-	 * @param {number} numBackRef - number of back-references
-	 * @return {boolean} return `true` to continue with recursion (this should be always the case except for `genrestartdata`)
+	 * @param {string} entryName - output buffer of at least `TINYTREE_NEND * 4 + 1` characters
 	 */
-	bool foundTreePrintTab(tinyTree_t &noname, const char *pName, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
-		static char entryName[tinyTree_t::TINYTREE_NEND * 4 + 1];
-
+	void tabName(char *entryName) {
 		/*
 		 * Translate to entry/display name
 		 */
@@ -261,6 +289,43 @@ struct genrestartdataContext_t : callable_t {
 			*pEntryname++ = Ti ? '!' : '?';
 		}
 		*pEntryname++ = 0;
+	}
+
+	/**
+	 * @date 2022-03-12 10:40:12
+	 *
+	 * Output restart entry
+	 *
+	 * @param {number} progress - absolute progress of restart tab
+	 * @param {string} entryName - display name of restart tab
+	 */
+	void printTab(uint64_t progress, const char *entryName) {
+		// tree is incomplete and requires a slightly different notation
+		printf("%12ldLL/*%s*/,", progress, entryName);
+
+		// `genprogress` needs to know how many restart points are generated.
+		this->numRestart++;
+
+		if (this->numRestart % 8 == 1)
+			printf("\n");
+	}
+
+	/**
+	 * @date 2020-04-16 10:10:46
+	 *
+	 * Found restart tab, Output restart entry
+	 *
+	 * @param {generatorTree_t} tree - candidate tree
+	 * @param {string} pName - tree notation/name
+	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
+	 * @param {number} numEndpoint - number of non-zero endpoints in tree
+	 * @param {number} numBackRef - number of back-references
+	 * @return {boolean} return `true` to continue with recursion (this should be always the case except for `genrestartdata`)
+	 */
+	bool foundTreePrintTab(tinyTree_t &noname, const char *pName, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		static char entryName[tinyTree_t::TINYTREE_NEND * 4 + 1];
+
+		tabName(entryName);
 
 		/*
 		 * Simply count how often called
@@ -287,19 +352,336 @@ struct genrestartdataContext_t : callable_t {
 			ctx.tick = 0;
 		}
 
-		// tree is incomplete and requires a slightly different notation
-		printf("%12ldLL/*%s*/,", ctx.progress, entryName);
-
-		// `genprogress` needs to know how many restart points are generated.
-		this->numRestart++;
-
-		if (this->numRestart % 8 == 1)
-			printf("\n");
+		printTab(ctx.progress, entryName);
 
 		// collecting restartdata, so continue with recursion
 		return true;
 	}
 
+	/**
+	 * @date 2022-03-12 10:52:18
+	 *
+	 * Found restart tab, register it as task
+	 *
+	 * @param {generatorTree_t} tree - candidate tree
+	 * @param {string} pName - tree notation/name
+	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
+	 * @param {number} numEndpoint - number of non-zero endpoints in tree
+	 * @param {number} numBackRef - number of back-references
+	 * @return {boolean} return `true` to continue with recursion (this should be always the case except for `genrestartdata`)
+	 */
+	bool foundTreeCollectTab(tinyTree_t &noname, const char *pName, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		this->numTasks++;
+
+		// first pass only counts
+		if (this->pTasks)
+			tabName(this->pTasks[this->numTasks].name);
+
+		// collecting tabs, no recursion
+		return false;
+	}
+
+	/**
+	 * @date 2022-03-12 11:04:40
+	 *
+	 * Create a task for every restart tab of every section.
+	 * Sections without restart tabs get a single task that counts the whole section.
+	 * Only the tabs themselves are visited, skipping everything below them.
+	 */
+	void createTasks(void) {
+
+		// put generator in `genrestartdata` mode
+		ctx.opt_debug |= context_t::DEBUGMASK_GENERATOR_TABS;
+
+		// first pass counts, second pass populates
+		for (unsigned iPass = 0; iPass < 2; iPass++) {
+			this->numTasks = 0;
+
+			// @formatter:off
+			for (unsigned numArgs = 1; numArgs <= generator_t::GENERATOR_MAXNODES; numArgs++)
+			for (int iPure = 1; iPure >= 0; iPure--) {
+			// @formatter:on
+
+				const metricsGenerator_t *pMetrics = getMetricsGenerator(MAXSLOTS, numArgs, iPure);
+				if (!pMetrics || (pMetrics->noauto & 1))
+					continue; // skip automated handling
+
+				// apply settings
+				ctx.flags = iPure ? ctx.flags | context_t::MAGICMASK_PURE : ctx.flags & ~context_t::MAGICMASK_PURE;
+				generator.initialiseGenerator();
+
+				unsigned firstTask     = this->numTasks + 1;
+				unsigned endpointsLeft = numArgs * 2 + 1;
+
+				generator.clearGenerator();
+				generator.generateTrees(numArgs, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&genrestartdataContext_t::foundTreeCollectTab));
+
+				if (this->numTasks < firstTask) {
+					// no tabs, count section as a whole
+					this->numTasks++;
+					if (this->pTasks)
+						this->pTasks[this->numTasks].name[0] = 0;
+				}
+
+				if (this->pTasks) {
+					for (unsigned iTask = firstTask; iTask <= this->numTasks; iTask++) {
+						restartTask_t *pTask = this->pTasks + iTask;
+
+						pTask->numArgs = numArgs;
+						pTask->iPure   = iPure;
+						// tabs without name are whole sections
+						pTask->iTab    = pTask->name[0] ? iTask - firstTask + 1 : 0;
+					}
+				}
+			}
+
+			if (iPass == 0) {
+				// shared with workers
+				this->pTasks = (restartTask_t *) ::mmap(NULL, sizeof(*this->pTasks) * (this->numTasks + 1), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+				if (this->pTasks == MAP_FAILED)
+					ctx.fatal("\n{\"error\":\"mmap() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__);
+			}
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Created %u tasks\n", ctx.timeAsString(), this->numTasks);
+	}
+
+	/**
+	 * @date 2022-03-12 11:20:09
+	 *
+	 * Load completed tasks from checkpoint and open it for appending.
+	 * Lines that do not match a task (a changed generator) are ignored.
+	 *
+	 * Line format: <numArgs> <iPure> <iTab> <numProgress> <name>
+	 *
+	 * @return {FILE} checkpoint file opened for appending
+	 */
+	FILE *loadCheckpoint(void) {
+		unsigned numLoaded = 0, numStale = 0;
+
+		FILE *f = ::fopen(this->opt_checkpoint, "r");
+		if (f) {
+			char line[256], name[256];
+			unsigned numArgs, iPure, iTab;
+			uint64_t numProgress;
+
+			while (::fgets(line, sizeof(line), f)) {
+				if (::sscanf(line, "%u %u %u %lu %s", &numArgs, &iPure, &iTab, &numProgress, name) != 5) {
+					numStale++;
+					continue;
+				}
+
+				bool found = false;
+				for (unsigned iTask = 1; iTask <= this->numTasks; iTask++) {
+					restartTask_t *pTask = this->pTasks + iTask;
+
+					if (pTask->numArgs == numArgs && pTask->iPure == iPure && pTask->iTab == iTab && ::strcmp(pTask->iTab ? pTask->name : "-", name) == 0) {
+						pTask->numProgress = numProgress;
+						pTask->done        = 1;
+						found = true;
+						break;
+					}
+				}
+
+				if (found)
+					numLoaded++;
+				else
+					numStale++;
+			}
+
+			::fclose(f);
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Loaded %u tasks from checkpoint \"%s\", %u ignored\n", ctx.timeAsString(), numLoaded, this->opt_checkpoint, numStale);
+
+		f = ::fopen(this->opt_checkpoint, "a");
+		if (!f)
+			ctx.fatal("\n{\"error\":\"fopen() failed\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"reason\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, this->opt_checkpoint);
+
+		return f;
+	}
+
+	/**
+	 * @date 2022-03-12 11:41:27
+	 *
+	 * Count all tasks using `--jobs` forked workers.
+	 * Workers pick tasks from a shared counter and announce completion through a pipe.
+	 */
+	void runTasks(void) {
+
+		createTasks();
+
+		FILE *hCheckpoint = this->opt_checkpoint ? loadCheckpoint() : NULL;
+
+		/*
+		 * Setup ticker
+		 */
+
+		uint64_t progressHi = 0;
+		for (unsigned iTask = 1; iTask <= this->numTasks; iTask++) {
+			const metricsGenerator_t *pMetrics = getMetricsGenerator(MAXSLOTS, this->pTasks[iTask].numArgs, this->pTasks[iTask].iPure);
+
+			if (pMetrics && this->pTasks[iTask].iTab <= 1)
+				progressHi += pMetrics->numProgress; // once per section
+		}
+
+		ctx.setupSpeed(progressHi);
+		ctx.tick = 0;
+
+		unsigned numDone = 0;
+		for (unsigned iTask = 1; iTask <= this->numTasks; iTask++) {
+			if (this->pTasks[iTask].done) {
+				ctx.progress += this->pTasks[iTask].numProgress;
+				numDone++;
+			}
+		}
+
+		/*
+		 * Start workers
+		 */
+
+		unsigned numJobs = this->opt_jobs ? this->opt_jobs : 1;
+		int      fds[2];
+
+		if (::pipe(fds) != 0)
+			ctx.fatal("\n{\"error\":\"pipe() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		pid_t *pWorkers = (pid_t *) ctx.myAlloc("genrestartdataContext_t::pWorkers", numJobs, sizeof(*pWorkers));
+
+		// flush before forking or buffered output gets duplicated
+		fflush(stdout);
+		fflush(stderr);
+
+		for (unsigned iJob = 0; iJob < numJobs && numDone < this->numTasks; iJob++) {
+			pWorkers[iJob] = ::fork();
+			if (pWorkers[iJob] < 0)
+				ctx.fatal("\n{\"error\":\"fork() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+
+			if (pWorkers[iJob] == 0) {
+				/*
+				 * Worker
+				 */
+				::close(fds[0]);
+
+				unsigned lastArgs = 0, lastPure = 0;
+
+				for (;;) {
+					uint32_t iTask = (uint32_t) __sync_add_and_fetch(&this->pTasks[0].numProgress, 1);
+					if (iTask > this->numTasks)
+						break;
+
+					restartTask_t *pTask = this->pTasks + iTask;
+					if (pTask->done)
+						continue; // from checkpoint
+
+					if (pTask->numArgs != lastArgs || pTask->iPure != lastPure) {
+						ctx.flags = pTask->iPure ? ctx.flags | context_t::MAGICMASK_PURE : ctx.flags & ~context_t::MAGICMASK_PURE;
+						generator.initialiseGenerator();
+
+						lastArgs = pTask->numArgs;
+						lastPure = pTask->iPure;
+					}
+
+					// isolate tab and count what is below it
+					ctx.progress       = 0;
+					this->numRestart   = 0;
+					this->opt_taskId   = pTask->iTab;
+					unsigned endpointsLeft = pTask->numArgs * 2 + 1;
+
+					generator.clearGenerator();
+					generator.generateTrees(pTask->numArgs, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&genrestartdataContext_t::foundTreeFilterTab));
+
+					pTask->numProgress = ctx.progress;
+
+					if (::write(fds[1], &iTask, sizeof(iTask)) != sizeof(iTask))
+						::_exit(1);
+				}
+
+				::_exit(0);
+			}
+		}
+
+		::close(fds[1]);
+
+		/*
+		 * Collect results
+		 */
+
+		while (numDone < this->numTasks) {
+			uint32_t iTask;
+
+			if (::read(fds[0], &iTask, sizeof(iTask)) != sizeof(iTask))
+				ctx.fatal("\n{\"error\":\"worker failed\",\"where\":\"%s:%s:%d\",\"numDone\":%u,\"numTasks\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, numDone, this->numTasks);
+
+			restartTask_t *pTask = this->pTasks + iTask;
+
+			pTask->done = 1;
+			ctx.progress += pTask->numProgress;
+			numDone++;
+
+			if (hCheckpoint) {
+				fprintf(hCheckpoint, "%u %u %u %lu %s\n", pTask->numArgs, pTask->iPure, pTask->iTab, pTask->numProgress, pTask->iTab ? pTask->name : "-");
+				fflush(hCheckpoint);
+			}
+
+			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
+				int perSecond = ctx.updateSpeed();
+
+				if (perSecond == 0 || ctx.progress > ctx.progressHi) {
+					fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %u/%u",
+						ctx.timeAsString(), ctx.progress, perSecond, numDone, this->numTasks);
+				} else {
+					int eta = (int) ((ctx.progressHi - ctx.progress) / perSecond);
+
+					int etaH = eta / 3600;
+					eta %= 3600;
+					int etaM = eta / 60;
+					eta %= 60;
+					int etaS = eta;
+
+					fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% eta=%d:%02d:%02d %u/%u",
+						ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi, etaH, etaM, etaS, numDone, this->numTasks);
+				}
+
+				ctx.tick = 0;
+			}
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
+			fprintf(stderr, "\r\e[K");
+
+		::close(fds[0]);
+
+		/*
+		 * Reap workers
+		 */
+
+		for (unsigned iJob = 0; iJob < numJobs; iJob++) {
+			int status;
+
+			if (pWorkers[iJob] <= 0)
+				continue; // not started
+			if (::waitpid(pWorkers[iJob], &status, 0) != pWorkers[iJob] || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+				ctx.fatal("\n{\"error\":\"worker failed\",\"where\":\"%s:%s:%d\",\"worker\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, iJob);
+		}
+
+		ctx.myFree("genrestartdataContext_t::pWorkers", pWorkers);
+
+		if (hCheckpoint)
+			::fclose(hCheckpoint);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+			fprintf(stderr, "[%s] Counted %u tasks with %u jobs\n", ctx.timeAsString(), this->numTasks, numJobs);
+	}
+
 	/**
 	 * @date 2020-03-19 20:58:57
 	 *
@@ -307,6 +689,10 @@ struct genrestartdataContext_t : callable_t {
 	 */
 	void main(void) {
 
+		// count tabs in parallel and/or resumable
+		if (this->opt_jobs > 1 || this->opt_checkpoint)
+			runTasks();
+
 		// put generator in `genrestartdata` mode
 		ctx.opt_debug |= context_t::DEBUGMASK_GENERATOR_TABS;
 
@@ -337,18 +723,35 @@ struct genrestartdataContext_t : callable_t {
 			// save section
 			buildSection[numArgs][iPure] = this->numRestart;
 
-			// apply settings
-			ctx.flags = iPure ? ctx.flags | context_t::MAGICMASK_PURE : ctx.flags & ~context_t::MAGICMASK_PURE;
-			generator.initialiseGenerator();
+			if (this->pTasks) {
+				// restart points are the running sum of the preceding tabs
+				uint64_t progress = 0;
 
-			ctx.setupSpeed(pMetrics->numProgress);
-			ctx.tick = 0;
+				for (unsigned iTask = 1; iTask <= this->numTasks; iTask++) {
+					const restartTask_t *pTask = this->pTasks + iTask;
+
+					if (pTask->numArgs == numArgs && pTask->iPure == (unsigned) iPure) {
+						if (pTask->iTab)
+							printTab(progress, pTask->name);
+						progress += pTask->numProgress;
+					}
+				}
+
+				ctx.progress = progress;
+			} else {
+				// apply settings
+				ctx.flags = iPure ? ctx.flags | context_t::MAGICMASK_PURE : ctx.flags & ~context_t::MAGICMASK_PURE;
+				generator.initialiseGenerator();
+
+				ctx.setupSpeed(pMetrics->numProgress);
+				ctx.tick = 0;
 
-			// do not supply a callback so `generateTrees` is aware restart data is being created
-			unsigned endpointsLeft = numArgs * 2 + 1;
+				// do not supply a callback so `generateTrees` is aware restart data is being created
+				unsigned endpointsLeft = numArgs * 2 + 1;
 
-			generator.clearGenerator();
-			generator.generateTrees(numArgs, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&genrestartdataContext_t::foundTreePrintTab));
+				generator.clearGenerator();
+				generator.generateTrees(numArgs, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&genrestartdataContext_t::foundTreePrintTab));
+			}
 
 			// display output section delimiter
 			printf(" 0xffffffffffffffffLL,");
@@ -390,6 +793,11 @@ struct genrestartdataContext_t : callable_t {
 		printf("};\n\n");
 		printf("#endif\n");
 
+		if (this->pTasks) {
+			::munmap(this->pTasks, sizeof(*this->pTasks) * (this->numTasks + 1));
+			this->pTasks = NULL;
+		}
+
 		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
 			fprintf(stderr, "[%s] Done\n", ctx.timeAsString());
 
@@ -459,10 +867,13 @@ void usage(char *argv[], bool verbose) {
 	fprintf(stderr, "usage: %s                  -- generate contents for \"restartdata.h\"\n", argv[0]);
 	fprintf(stderr, "       %s --text <numnode> -- display all unique candidates with given node size\n", argv[0]);
 	fprintf(stderr, "       %s --task=n,m <numnode> -- display single line for requested task/tab\n", argv[0]);
+	fprintf(stderr, "       %s --jobs=<number> [--checkpoint=<file>] -- generate contents for \"restartdata.h\" in parallel/resumable\n", argv[0]);
 
 	if (verbose) {
 		fprintf(stderr, "\n");
+		fprintf(stderr, "\t   --checkpoint=<file>     Log completed tasks and resume from them\n");
 		fprintf(stderr, "\t-h --help                  This list\n");
+		fprintf(stderr, "\t   --jobs=<number>         Number of worker processes [default=%u]\n", app.opt_jobs);
 		fprintf(stderr, "\t   --[no-]paranoid         Enable expensive assertions [default=%s]\n", (ctx.flags & context_t::MAGICMASK_PARANOID) ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]pure             Enable QTF->QnTF rewriting [default=%s]\n", (ctx.flags & context_t::MAGICMASK_PURE) ? "enabled" : "disabled");
 		fprintf(stderr, "\t-q --quiet                 Say less\n");
@@ -493,7 +904,9 @@ int main(int argc, char *argv[]) {
 		enum {
 			// long-only opts
 			LO_ANCIENT = 1,
+			LO_CHECKPOINT,
 			LO_DEBUG,
+			LO_JOBS,
 			LO_NOPARANOID,
 			LO_NOPURE,
 			LO_PARANOID,
@@ -510,8 +923,10 @@ int main(int argc, char *argv[]) {
 		// long option descriptions
 		static struct option long_options[] = {
 			/* name, has_arg, flag, val */
+			{"checkpoint",  1, 0, LO_CHECKPOINT},
 			{"debug",       1, 0, LO_DEBUG},
 			{"help",        0, 0, LO_HELP},
+			{"jobs",        1, 0, LO_JOBS},
 			{"no-paranoid", 0, 0, LO_NOPARANOID},
 			{"no-pure",     0, 0, LO_NOPURE},
 			{"paranoid",    0, 0, LO_PARANOID},
@@ -549,12 +964,18 @@ int main(int argc, char *argv[]) {
 			break;
 
 		switch (c) {
+		case LO_CHECKPOINT:
+			app.opt_checkpoint = optarg;
+			break;
 		case LO_DEBUG:
 			ctx.opt_debug = ::strtoul(optarg, NULL, 0);
 			break;
 		case LO_HELP:
 			usage(argv, true);
 			exit(0);
+		case LO_JOBS:
+			app.opt_jobs = ::strtoul(optarg, NULL, 0);
+			break;
 		case LO_NOPARANOID:
 			ctx.flags &= ~context_t::MAGICMASK_PARANOID;
 			break;
@@ -8,6 +8,11 @@
  * 	Address space is simple "abc!def!ghi!!" (with all QTF/QTnF combos)
  * 	There are to flavours, non-destructive and destructive.
  * 	The first rewrites only the top-level QTF operator, the latter will also rewrite operands
+ *
+ * @date 2022-03-12 16:20:44
+ * 	With `--jobs=<n>` the expensive search for the best rewrite is performed by forked workers.
+ * 	Workers claim fixed-size blocks of `progress` and store results in a shared candidate index (by `progress`).
+ * 	Building the state table remains sequential and picks up the precomputed candidates, output is unchanged.
  */
 
 /*
@@ -33,7 +38,9 @@
 #include <signal.h>
 #include <string.h>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include "database.h"
@@ -42,6 +49,11 @@
 
 struct genrewritedataContext_t {
 
+	enum {
+		NUMPROGRESS = 940140, // number of slot-relative combinations, was 198072
+		CLAIMBLOCK  = 1024,   // `--jobs` workers claim work in blocks of this many `progress`
+	};
+
 	struct print_t {
 		char        name[tinyTree_t::TINYTREE_NAMELEN + 1];
 		footprint_t footprint;
@@ -49,11 +61,35 @@ struct genrewritedataContext_t {
 		uint32_t    score;
 	};
 
+	/*
+	 * @date 2022-03-12 16:28:10
+	 *
+	 * Best rewrite found for a candidate.
+	 * Q/Tu/Ti/F/root are tree node id's, they are made slot relative by the caller.
+	 */
+	struct candidate_t {
+		char     bestName[tinyTree_t::TINYTREE_NAMELEN + 1];
+		uint32_t bestScore;
+		uint32_t bestSize;
+		uint8_t  Q;
+		uint8_t  Tu;
+		uint8_t  Ti;
+		uint8_t  F;
+		uint8_t  root;
+		uint8_t  power;
+	};
+
 	/// @var {context_t} I/O context
 	context_t &ctx;
 
 	uint32_t opt_flags;
 	uint32_t opt_first;
+	uint32_t opt_jobs;
+
+	// candidate index, shared with workers
+	uint32_t    maxCandidates;
+	candidate_t *pCandidates;
+	uint32_t    *pClaims;       // `progress` blocks claimed by workers
 
 	uint32_t iVersion;
 
@@ -89,6 +125,10 @@ struct genrewritedataContext_t {
 		ctx(ctx),
 		opt_flags(0),
 		opt_first(1<<5), // assuming tinyTree_t nodeID's fit in 5 bits, so start after that
+		opt_jobs(0),
+		maxCandidates(0),
+		pCandidates(NULL),
+		pClaims(NULL),
 		iVersion(1),
 		// imprint store
 		numPrints(0), // do not start at 0
@@ -184,7 +224,7 @@ struct genrewritedataContext_t {
 		 */
 
 		progress      = 0;
-		progressHi    = 940140; // 198072;
+		progressHi    = NUMPROGRESS;
 		progressCoef  = progressCoefMin;
 		progressLast  = 0;
 		progressSpeed = 0;
@@ -447,7 +487,7 @@ struct genrewritedataContext_t {
 		 */
 
 		progress      = 0;
-		progressHi    = 940140; // 198072;
+		progressHi    = NUMPROGRESS;
 		progressCoef  = progressCoefMin;
 		progressLast  = 0;
 		progressSpeed = 0;
@@ -847,6 +887,95 @@ struct genrewritedataContext_t {
 		return pos;
 	}
 
+	/*
+	 * @date 2022-03-12 16:35:52
+	 *
+	 * Find highest scoring target
+	 * Candidates are all permutations of 3-out-of-N slots
+	 */
+	void findBest(const tinyTree_t &tree, tinyTree_t &testTree, footprint_t *pEval, const footprint_t &origFoot, uint32_t nextNode3, uint32_t nextSlot3, candidate_t *pBest) {
+
+		const unsigned NSTART = tinyTree_t::TINYTREE_NSTART;
+
+		tinyTree_t bestTree(ctx);
+
+		pBest->bestName[0] = 0;
+		pBest->bestScore   = 0;
+		pBest->bestSize    = 0;
+
+		// copy tree
+		testTree.clearTree();
+		testTree.N[NSTART + 0] = tree.N[NSTART + 0];
+		testTree.N[NSTART + 1] = tree.N[NSTART + 1];
+		testTree.N[NSTART + 2] = tree.N[NSTART + 2];
+		testTree.N[NSTART + 3] = tree.N[NSTART + 3];
+		testTree.root  = tree.root;
+		testTree.count = tree.count;
+
+
+		//@formatter:off
+		for (uint32_t testQ = 0; testQ < nextNode3; testQ++)
+		for (uint32_t testTu = 0; testTu < nextNode3; testTu++)
+		for (uint32_t testTi = 0; testTi < 2; testTi++)
+		for (uint32_t testF = 0; testF < nextNode3; testF++) {
+		//@formatter:on
+
+			if (testQ < NSTART && testQ > nextSlot3) continue;
+			if (testTu < NSTART && testTu > nextSlot3) continue;
+			if (testF < NSTART && testF > nextSlot3) continue;
+
+			// validate
+			if (testQ != testTu || testQ != testF || testTi) {
+				if (testQ == 0 && (testTu || testTi || testF)) continue;
+				if (testQ == testTu) continue;             // Q/T fold
+				if (testQ == testF) continue;              // Q/F fold
+				if (testTu == testF && testTi == 0) continue; // T/F fold
+				if (testTu == 0 && testTi == 0) continue;  // Q?0:F -> F?!Q:0
+				if (testTu == 0 && testF == 0) continue;   // Q?!0:0 -> Q
+			}
+
+			/*
+			 * Load into a test tree
+			 */
+
+			testTree.N[NSTART + 0] = tree.N[NSTART + 0];
+			testTree.N[NSTART + 1] = tree.N[NSTART + 1];
+			testTree.N[NSTART + 2] = tree.N[NSTART + 2];
+			testTree.count = tree.count;
+			testTree.root = testTree.addNormaliseNode(testQ, testTu ^ (testTi ? IBIT : 0), testF);
+
+			// reload tree for optimal name and origScore
+			const char *pName = testTree.saveString(testTree.root);
+			testTree.loadStringFast(pName);
+
+			// test if footprint match
+			testTree.eval(pEval);
+			if (!origFoot.equals(pEval[testTree.root]))
+				continue;
+
+			// determine if better target
+			uint64_t testScore = testTree.calcScoreName(pName);
+			if (pBest->bestName[0] == 0 || testScore < pBest->bestScore || (testScore == pBest->bestScore && testTree.compare(testTree.root, &bestTree, bestTree.root) < 0)) {
+				// rember best candidate
+				for (uint32_t iNode=NSTART; iNode<tree.count; iNode++)
+					bestTree.N[iNode] = tree.N[iNode];
+				bestTree.root = tree.root;
+				testTree.saveString(testTree.root, pBest->bestName, NULL);
+				pBest->bestScore = testScore;
+				pBest->bestSize  = testTree.count - NSTART;
+
+				// node id's before tree changes (references change when tree shrinks)
+				pBest->root  = testTree.root;
+				pBest->Q     = testQ;
+				pBest->Tu    = testTu;
+				pBest->Ti    = testTi;
+				pBest->F     = testF;
+				pBest->power = tree.count - testTree.count;
+			}
+		}
+		assert(pBest->bestName[0]);
+	}
+
 	void main(void) {
 		/*
 		 * Create evaluator vector for 4n9.
@@ -875,6 +1004,8 @@ struct genrewritedataContext_t {
 			if (i & (1 << 8)) pEval[tinyTree_t::TINYTREE_KSTART + 8].bits[i / 64] |= 1LL << (i % 64);
 		}
 
+		const unsigned NSTART = tinyTree_t::TINYTREE_NSTART;
+
 		/*
 		 * Create trees.
 		 * NOTE: `baseTree_t` are not allowed because they depend on data this program generates
@@ -882,7 +1013,63 @@ struct genrewritedataContext_t {
 		tinyTree_t tree(ctx);
 		tinyTree_t testTree(ctx);
 
-		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+		/*
+		 * With multiple jobs, workers perform the search into the shared candidate index
+		 */
+		bool     isWorker  = false;
+		unsigned numJobs   = this->opt_jobs;
+		pid_t    *pWorkers = NULL;
+
+		if (numJobs > 1) {
+			maxCandidates = NUMPROGRESS + 1; // `progress` is pre-incremented
+			pCandidates   = (candidate_t *) ::mmap(NULL, sizeof(*pCandidates) * maxCandidates, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+			pClaims       = (uint32_t *) ::mmap(NULL, sizeof(*pClaims) * (maxCandidates / CLAIMBLOCK + 1), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+			if (pCandidates == MAP_FAILED || pClaims == MAP_FAILED)
+				ctx.fatal("\n{\"error\":\"mmap() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+
+			if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+				fprintf(stderr, "\r\e[K[%s] Search candidates with %u jobs [progress(speed) eta]\n", ctx.timeAsString(), numJobs);
+
+			pWorkers = (pid_t *) ctx.myAlloc("pWorkers", numJobs, sizeof(*pWorkers));
+
+			// flush before forking or buffered output gets duplicated
+			fflush(stdout);
+			fflush(stderr);
+
+			for (unsigned iJob = 0; iJob < numJobs; iJob++) {
+				pWorkers[iJob] = ::fork();
+				if (pWorkers[iJob] < 0)
+					ctx.fatal("\n{\"error\":\"fork() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__);
+
+				if (pWorkers[iJob] == 0) {
+					isWorker = true;
+
+					// only the first worker displays progress
+					ctx.tick = 0;
+					if (iJob != 0)
+						ctx.opt_verbose = ctx.VERBOSE_WARNING;
+					else if (ctx.opt_timer)
+						::alarm(ctx.opt_timer);
+					break;
+				}
+			}
+
+			if (!isWorker) {
+				for (unsigned iJob = 0; iJob < numJobs; iJob++) {
+					int status;
+
+					if (::waitpid(pWorkers[iJob], &status, 0) != pWorkers[iJob] || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+						ctx.fatal("\n{\"error\":\"worker failed\",\"where\":\"%s:%s:%d\",\"worker\":%u}\n",
+							  __FUNCTION__, __FILE__, __LINE__, iJob);
+				}
+
+				ctx.myFree("pWorkers", pWorkers);
+			}
+		}
+
+		if (!isWorker && ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
 			fprintf(stderr, "\r\e[K[%s] Find sources [progress(speed) eta cntFound cntShrink cntNode0 cntNode1 cntNode2 cntNode3 cntNode4]\n", ctx.timeAsString());
 
 		// setup first block
@@ -901,11 +1088,14 @@ struct genrewritedataContext_t {
 		 * Keeping it for posterity and as an independent implementation to optionally compare with the generator.
 		 */
 
-		ctx.setupSpeed(940140); // 198072;
+		ctx.setupSpeed(NUMPROGRESS);
 
-		const unsigned NSTART     = tinyTree_t::TINYTREE_NSTART;
 		const unsigned NAMELENGTH = tinyTree_t::TINYTREE_NAMELEN;
 
+		// workers search only blocks they claimed, but enumerate all to keep `progress` in sync
+		uint32_t claimBlock = ~0U;
+		bool     isClaimed  = false;
+
 		//@formatter:off
 		for (uint32_t Q1 = 1; Q1 < NSTART+0; Q1++)
 		for (uint32_t Tu1 = 0; Tu1 < NSTART+0; Tu1++)
@@ -1057,14 +1247,20 @@ struct genrewritedataContext_t {
 							eta %= 60;
 							int etaS = eta;
 
-							fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% %3d:%02d:%02d %d %d %d(%.2f%%) %d(%.2f%%) %d(%.2f%%) %d(%.2f%%) %d(%.2f%%)",
-								ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi, etaH, etaM, etaS,
-								gCntFound, gCntTree,
-								gCntNode[0], gCntNode[0] * 100.0 / gCntFound,
-								gCntNode[1], gCntNode[1] * 100.0 / gCntFound,
-								gCntNode[2], gCntNode[2] * 100.0 / gCntFound,
-								gCntNode[3], gCntNode[3] * 100.0 / gCntFound,
-								gCntNode[4], gCntNode[4] * 100.0 / gCntFound);
+							if (isWorker) {
+								// workers only search, counters are updated by the parent
+								fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% %3d:%02d:%02d",
+									ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi, etaH, etaM, etaS);
+							} else {
+								fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% %3d:%02d:%02d %d %d %d(%.2f%%) %d(%.2f%%) %d(%.2f%%) %d(%.2f%%) %d(%.2f%%)",
+									ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi, etaH, etaM, etaS,
+									gCntFound, gCntTree,
+									gCntNode[0], gCntNode[0] * 100.0 / gCntFound,
+									gCntNode[1], gCntNode[1] * 100.0 / gCntFound,
+									gCntNode[2], gCntNode[2] * 100.0 / gCntFound,
+									gCntNode[3], gCntNode[3] * 100.0 / gCntFound,
+									gCntNode[4], gCntNode[4] * 100.0 / gCntFound);
+							}
 
 							ctx.tick = 0;
 						}
@@ -1073,6 +1269,25 @@ struct genrewritedataContext_t {
 						tree.count = nextNode3;
 						tree.root  = tree.addNormaliseNode(tlQ, tlTu ^ (tlTi ? IBIT : 0), tlF);
 
+						if (isWorker) {
+							if (ctx.progress >= maxCandidates)
+								ctx.fatal("\n[%s %s:%u storage full %d]\n", __FUNCTION__, __FILE__, __LINE__, maxCandidates);
+
+							// top-level slices are few and very uneven, claim small blocks instead
+							if (ctx.progress / CLAIMBLOCK != claimBlock) {
+								claimBlock = ctx.progress / CLAIMBLOCK;
+								isClaimed  = __sync_bool_compare_and_swap(&pClaims[claimBlock], 0, 1);
+							}
+
+							if (isClaimed) {
+								tree.eval(pEval);
+								footprint_t origFoot = pEval[tree.root];
+
+								findBest(tree, testTree, pEval, origFoot, nextNode3, nextSlot3, pCandidates + ctx.progress);
+							}
+							continue;
+						}
+
 						/*
 						 * @date 2021-06-12 00:00:57
 						 *
@@ -1124,94 +1339,33 @@ struct genrewritedataContext_t {
 						uint32_t origData = tlTi << 12 | normMap[tlQ] << 8 | normMap[tlTu] << 4 | normMap[tlF];
 
 						/*
-						 * Find highest scoring target
-						 * Candidates are all permutations of 3-out-of-N slots
+						 * Find highest scoring target, precomputed by workers or now
 						 */
 
-						tinyTree_t bestTree(ctx);
-						char       bestName[NAMELENGTH + 1] = {0};
-						uint32_t   bestScore                = 0;
-						uint32_t   bestSize                 = 0;
-						uint32_t   bestData                 = 0;
+						candidate_t       candidate;
+						const candidate_t *pBest = pCandidates + ctx.progress;
 
-						{
-							// copy tree
-							testTree.clearTree();
-							testTree.N[NSTART + 0] = tree.N[NSTART + 0];
-							testTree.N[NSTART + 1] = tree.N[NSTART + 1];
-							testTree.N[NSTART + 2] = tree.N[NSTART + 2];
-							testTree.N[NSTART + 3] = tree.N[NSTART + 3];
-							testTree.root  = tree.root;
-							testTree.count = tree.count;
-
-
-							//@formatter:off
-							for (uint32_t testQ = 0; testQ < nextNode3; testQ++)
-							for (uint32_t testTu = 0; testTu < nextNode3; testTu++)
-							for (uint32_t testTi = 0; testTi < 2; testTi++)
-							for (uint32_t testF = 0; testF < nextNode3; testF++) {
-							//@formatter:on
-
-								if (testQ < NSTART && testQ > nextSlot3) continue;
-								if (testTu < NSTART && testTu > nextSlot3) continue;
-								if (testF < NSTART && testF > nextSlot3) continue;
-
-								// validate
-								if (testQ != testTu || testQ != testF || testTi) {
-									if (testQ == 0 && (testTu || testTi || testF)) continue;
-									if (testQ == testTu) continue;             // Q/T fold
-									if (testQ == testF) continue;              // Q/F fold
-									if (testTu == testF && testTi == 0) continue; // T/F fold
-									if (testTu == 0 && testTi == 0) continue;  // Q?0:F -> F?!Q:0
-									if (testTu == 0 && testF == 0) continue;   // Q?!0:0 -> Q
-								}
+						if (!pCandidates) {
+							findBest(tree, testTree, pEval, origFoot, nextNode3, nextSlot3, &candidate);
+							pBest = &candidate;
+						}
 
-								/*
-								 * Load into a test tree
-								 */
-
-								testTree.N[NSTART + 0] = tree.N[NSTART + 0];
-								testTree.N[NSTART + 1] = tree.N[NSTART + 1];
-								testTree.N[NSTART + 2] = tree.N[NSTART + 2];
-								testTree.count = tree.count;
-								testTree.root = testTree.addNormaliseNode(testQ, testTu ^ (testTi ? IBIT : 0), testF);
-
-								// create a data word before tree changes (references will change when tree shrinks)
-								uint32_t testData = (testTi ? 1 : 0) << 12 | normMap[testQ] << 8 | normMap[testTu] << 4 | normMap[testF];
-
-								// reload tree for optimal name and origScore
-								const char *pName = testTree.saveString(testTree.root);
-								testTree.loadStringFast(pName);
-
-								// test if footprint match
-								testTree.eval(pEval);
-								if (!origFoot.equals(pEval[testTree.root]))
-									continue;
-
-								// determine if better target
-								uint64_t testScore = testTree.calcScoreName(pName);
-								if (bestName[0] == 0 || testScore < bestScore || (testScore == bestScore && testTree.compare(testTree.root, &bestTree, bestTree.root) < 0)) {
-									// rember best candidate
-									for (uint32_t iNode=NSTART; iNode<tree.count; iNode++)
-										bestTree.N[iNode] = tree.N[iNode];
-									bestTree.root = tree.root;
-									testTree.saveString(testTree.root, bestName, NULL);
-									bestScore = testScore;
-									bestSize  = testTree.count - NSTART;
-
-									if (testTree.root < NSTART) {
-										bestData = REWRITEMASK_COLLAPSE | normMap[testTree.root]; // collapse
-									} else {
-										bestData = testData;
-										if (bestData == origData)
-											bestData |= REWRITEMASK_FOUND; // mark no rewrite required
-
-										// merge power for statistics
-										bestData |= (tree.count - testTree.count) << REWRITEFLAG_POWER;
-									}
-								}
-							}
-							assert(bestName[0]);
+						char     bestName[NAMELENGTH + 1];
+						uint32_t bestScore = pBest->bestScore;
+						uint32_t bestSize  = pBest->bestSize;
+						uint32_t bestData;
+
+						strcpy(bestName, pBest->bestName);
+
+						if (pBest->root < NSTART) {
+							bestData = REWRITEMASK_COLLAPSE | normMap[pBest->root]; // collapse
+						} else {
+							bestData = pBest->Ti << 12 | normMap[pBest->Q] << 8 | normMap[pBest->Tu] << 4 | normMap[pBest->F];
+							if (bestData == origData)
+								bestData |= REWRITEMASK_FOUND; // mark no rewrite required
+
+							// merge power for statistics
+							bestData |= pBest->power << REWRITEFLAG_POWER;
 						}
 
 #ifdef ENABLE_REWRITE_DESTRUCTIVE
@@ -1323,6 +1477,17 @@ struct genrewritedataContext_t {
 				}
 			}
 		}
+
+		if (isWorker)
+			::_exit(0);
+
+		if (pCandidates) {
+			::munmap(pCandidates, sizeof(*pCandidates) * maxCandidates);
+			::munmap(pClaims, sizeof(*pClaims) * (maxCandidates / CLAIMBLOCK + 1));
+			pCandidates = NULL;
+			pClaims     = NULL;
+		}
+
 		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
 			fprintf(stderr, "\r\e[K[%s] numData=%d numDataTree=%d\n",
 				ctx.timeAsString(),
@@ -1411,6 +1576,7 @@ void usage(char *const *argv, bool verbose) {
 	fprintf(stderr, "usage: %s\n", argv[0]);
 	if (verbose) {
 		fprintf(stderr, "\t   --first=<number> [default=%d]\n", app.opt_first);
+		fprintf(stderr, "\t   --jobs=<number> [default=%d]\n", app.opt_jobs);
 		fprintf(stderr, "\t-q --quiet\n");
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
 		fprintf(stderr, "\t-v --verbose\n");
@@ -1432,7 +1598,7 @@ int main(int argc, char *argv[]) {
 	for (;;) {
 		// Long option shortcuts
 		enum {
-			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FIRST,
+			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FIRST, LO_JOBS,
 			LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
 
@@ -1441,6 +1607,7 @@ int main(int argc, char *argv[]) {
 			{"debug",   1, 0, LO_DEBUG},
 			{"first",   1, 0, LO_FIRST},
 			{"help",    0, 0, LO_HELP},
+			{"jobs",    1, 0, LO_JOBS},
 			{"quiet",   2, 0, LO_QUIET},
 			{"timer",   1, 0, LO_TIMER},
 			{"verbose", 2, 0, LO_VERBOSE},
@@ -1480,6 +1647,9 @@ int main(int argc, char *argv[]) {
 		case LO_FIRST:
 			app.opt_first = (unsigned) strtoul(optarg, NULL, 10);
 			break;
+		case LO_JOBS:
+			app.opt_jobs = (unsigned) strtoul(optarg, NULL, 10);
+			break;
 		case LO_TIMER:
 			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
 			break;
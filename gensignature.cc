@@ -280,6 +280,7 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --[no-]pure                     QTF->QnTF (single-node) rewriting [default=%s]\n", (ctx.flags & context_t::MAGICMASK_PURE) ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]rewrite                  Structure (multi-node)  rewriting [default=%s]\n", (ctx.flags & context_t::MAGICMASK_REWRITE) ? "enabled" : "disabled");
 		fprintf(stderr, "\nGenerator options:\n");
+		fprintf(stderr, "\t   --jobs=<number>                 Number of worker processes for generator [default=%u]\n", app.opt_jobs);
 		fprintf(stderr, "\t   --mixed                         Only top-level node may be mixed QnTF/QTF, others are QnTF only\n");
 		fprintf(stderr, "\t   --task=sge                      Get task settings from SGE environment\n");
 		fprintf(stderr, "\t   --task=<id>,<last>              Task id/number of tasks. [default=%u,%u]\n", app.opt_taskId, app.opt_taskLast);
@@ -355,6 +356,7 @@ int main(int argc, char *argv[]) {
 			LO_PARANOID,
 			LO_PURE,
 			// generator options
+			LO_JOBS,
 			LO_MIXED,
 			LO_SID,
 			LO_TASK,
@@ -413,6 +415,7 @@ int main(int argc, char *argv[]) {
 			{"paranoid",           0, 0, LO_PARANOID},
 			{"pure",               0, 0, LO_PURE},
 			// generator options
+			{"jobs",               1, 0, LO_JOBS},
 			{"mixed",              0, 0, LO_MIXED},
 			{"task",               1, 0, LO_TASK},
 			{"window",             1, 0, LO_WINDOW},
@@ -560,6 +563,9 @@ int main(int argc, char *argv[]) {
 			/*
 			 * Generator options
 			 */
+		case LO_JOBS:
+			app.opt_jobs = ::strtoul(optarg, NULL, 0);
+			break;
 		case LO_MIXED:
 			app.opt_mixed++;
 			break;
@@ -209,6 +209,8 @@ struct gensignatureContext_t : dbtool_t {
 	unsigned   opt_force;
 	/// @var {number} Invoke generator for new candidates
 	unsigned   opt_generate;
+	/// @var {number} --jobs, number of worker processes for generator
+	unsigned   opt_jobs;
 	/// @var {number} List incomplete signatures (LOOKUP and !SAFE), for inclusion
 	unsigned   opt_listIncomplete;
 	/// @var {number} List empty/unsafe signatures, for exclusion
@@ -249,6 +251,29 @@ struct gensignatureContext_t : dbtool_t {
 	uint64_t        truncated;
 	/// @var {number} Name of signature causing overflow
 	char            truncatedName[tinyTree_t::TINYTREE_NAMELEN + 1];
+	/// @var {number} `mergeSignature()`, sid found by worker. Zero to lookup
+	uint32_t        mergeSid;
+
+	/*
+	 * @date 2022-03-10 23:06:12
+	 *
+	 * Candidate as emitted by a `--jobs` worker after filtering and associative lookup
+	 */
+	struct taskRecord_t {
+		uint64_t progress;
+		uint32_t sid;
+		uint8_t  numPlaceholder;
+		uint8_t  numEndpoint;
+		uint8_t  numBackRef;
+		char     name[tinyTree_t::TINYTREE_NAMELEN + 1];
+	};
+
+	/*
+	 * Worker counters, to be accumulated by the parent
+	 */
+	struct taskTrailer_t {
+		uint32_t skipDuplicate;
+	};
 
 	/**
 	 * Constructor
@@ -260,6 +285,7 @@ struct gensignatureContext_t : dbtool_t {
 		arg_outputDatabase = NULL;
 		opt_force          = 0;
 		opt_generate       = 1;
+		opt_jobs           = 0;
 		opt_listIncomplete = 0;
 		opt_listSafe       = 0;
 		opt_listUnsafe     = 0;
@@ -279,6 +305,7 @@ struct gensignatureContext_t : dbtool_t {
 		skipDuplicate    = 0;
 		truncated        = 0;
 		truncatedName[0] = 0;
+		mergeSid         = 0;
 	}
 
 	/*
@@ -368,6 +395,9 @@ struct gensignatureContext_t : dbtool_t {
 
 		/*
 		 * test for duplicates
+		 * NOTE: `--jobs` workers have a snapshot of the database.
+		 *       Signatures are never released, so names found in the snapshot are also duplicates for the parent.
+		 *       Names added by the parent after the snapshot are caught by `mergeSignature()`.
 		 */
 
 		unsigned six = pStore->lookupSignature(pNameR);
@@ -380,7 +410,7 @@ struct gensignatureContext_t : dbtool_t {
 		/*
 		 * Test for database overflow
 		 */
-		if (this->opt_truncate) {
+		if (this->opt_truncate && !generator.pTaskFile) {
 			// avoid `"storage full"`. Give warning later
 			if (pStore->maxImprint - pStore->numImprint <= pStore->interleave || pStore->maxSignature - pStore->numSignature <= pStore->IDFIRST) {
 				// break now, display text later/ Leave progress untouched
@@ -444,6 +474,32 @@ struct gensignatureContext_t : dbtool_t {
 		unsigned sid              = 0;
 		unsigned origNumSignature = pStore->numSignature;
 
+		if (generator.pTaskFile) {
+			/*
+			 * `--jobs` worker, only perform the associative lookup.
+			 * Signatures found in the snapshot are also found by the parent, others need a fresh lookup.
+			 * With add-if-not-found, leave everything to the parent.
+			 */
+			taskRecord_t rec;
+
+			if (!(ctx.flags & context_t::MAGICMASK_AINF) || this->readOnlyMode) {
+				unsigned tid = 0;
+				pStore->lookupImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
+			}
+
+			rec.progress       = ctx.progress;
+			rec.sid            = sid;
+			rec.numPlaceholder = numPlaceholder;
+			rec.numEndpoint    = numEndpoint;
+			rec.numBackRef     = numBackRef;
+			::strcpy(rec.name, pNameR);
+
+			if (::fwrite(&rec, sizeof(rec), 1, generator.pTaskFile) != 1)
+				ctx.fatal("\n{\"error\":\"fwrite() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+			return true;
+		}
+
 		if ((ctx.flags & context_t::MAGICMASK_AINF) && !this->readOnlyMode) {
 			/*
 			 * @date 2020-04-25 22:00:29
@@ -455,6 +511,9 @@ struct gensignatureContext_t : dbtool_t {
 			 */
 			// add to imprints to index
 			sid = pStore->addImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, origNumSignature);
+		} else if (this->mergeSid) {
+			// already looked up by `--jobs` worker
+			sid = this->mergeSid;
 		} else {
 			unsigned tid = 0;
 			pStore->lookupImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
@@ -887,6 +946,70 @@ struct gensignatureContext_t : dbtool_t {
 				skipDuplicate, (double) ctx.cntCompare / ctx.cntHash);
 	}
 
+	/**
+	 * @date 2022-03-14 00:56:18
+	 *
+	 * `--jobs` worker: end of task, append counters to output
+	 *
+	 * @param {FILE} f - task output
+	 */
+	void taskSignature(FILE *f) {
+		taskTrailer_t trailer;
+
+		trailer.skipDuplicate = skipDuplicate;
+
+		if (::fwrite(&trailer, sizeof(trailer), 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"fwrite() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		// counters are per task
+		skipDuplicate = 0;
+	}
+
+	/**
+	 * @date 2022-03-10 23:21:40
+	 *
+	 * `--jobs` parent: replay the output of a task through `foundTreeSignature()`.
+	 * Workers did the expensive associative lookups, the parent updates signatures/imprints in `progress` order.
+	 *
+	 * @param {FILE} f - task output
+	 * @param {number} length - size of task output
+	 * @return {boolean} `false` on database overflow
+	 */
+	bool mergeSignature(FILE *f, uint64_t length) {
+		assert(length >= sizeof(taskTrailer_t) && (length - sizeof(taskTrailer_t)) % sizeof(taskRecord_t) == 0);
+
+		uint64_t   numRecord = (length - sizeof(taskTrailer_t)) / sizeof(taskRecord_t);
+		tinyTree_t tree(ctx);
+
+		for (uint64_t iRecord = 0; iRecord < numRecord; iRecord++) {
+			taskRecord_t rec;
+
+			if (::fread(&rec, sizeof(rec), 1, f) != 1)
+				ctx.fatal("\n{\"error\":\"fread() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__);
+
+			ctx.progress = rec.progress;
+			tree.loadStringFast(rec.name);
+
+			this->mergeSid = rec.sid;
+			bool ret = foundTreeSignature(tree, rec.name, rec.numPlaceholder, rec.numEndpoint, rec.numBackRef);
+			this->mergeSid = 0;
+
+			if (!ret)
+				return false;
+		}
+
+		taskTrailer_t trailer;
+		if (::fread(&trailer, sizeof(trailer), 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"fread() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		skipDuplicate += trailer.skipDuplicate;
+
+		return true;
+	}
+
 	/**
 	 * @date 2020-03-22 01:00:05
 	 *
@@ -918,8 +1041,8 @@ struct gensignatureContext_t : dbtool_t {
 		generator.windowLo = this->opt_windowLo;
 		generator.windowHi = this->opt_windowHi;
 
-		// setup restart data, only for 5n9+
-		if (arg_numNodes > 4) {
+		// setup restart data, only for 5n9+ or when tasks are needed for `--jobs`
+		if (arg_numNodes > 4 || this->opt_jobs > 1) {
 			// walk through list
 			const metricsRestart_t *pRestart = getMetricsRestart(MAXSLOTS, arg_numNodes, ctx.flags & context_t::MAGICMASK_PURE);
 			// point to first entry if section present
@@ -954,8 +1077,16 @@ struct gensignatureContext_t : dbtool_t {
 			unsigned endpointsLeft = arg_numNodes * 2 + 1;
 
 			generator.initialiseGenerator();
-			generator.clearGenerator();
-			generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&gensignatureContext_t::foundTreeSignature));
+
+			if (this->opt_jobs > 1) {
+				generator.generateTasks(this->opt_jobs, arg_numNodes, this,
+							static_cast<generator_t::generateTreeCallback_t>(&gensignatureContext_t::foundTreeSignature),
+							static_cast<generator_t::generateTaskCallback_t>(&gensignatureContext_t::taskSignature),
+							static_cast<generator_t::mergeTaskCallback_t>(&gensignatureContext_t::mergeSignature));
+			} else {
+				generator.clearGenerator();
+				generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generator_t::generateTreeCallback_t>(&gensignatureContext_t::foundTreeSignature));
+			}
 		}
 
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
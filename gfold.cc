@@ -18,6 +18,10 @@
  *                                     
  * Discovered that the structure base compare is incomplete and needs additional logic for cascading dyadics.
  * Keep the original `main()` as the new code is word-in-progress.
+ *
+ * @date 2022-03-13 10:21:47
+ * `--jobs=<number>` lets forked workers score stale fold candidates ahead of the lazy refresh.
+ * Output does not depend on the number of jobs.
  */
 
 /*
@@ -44,7 +48,10 @@
 #include <getopt.h>
 #include <jansson.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
 #include "context.h"
 #include "grouptree.h"
@@ -95,6 +102,10 @@ struct gfoldContext_t {
 	unsigned   opt_force;
 	/// @var {number} --maxnode, Maximum number of nodes for `groupTree_t`.
 	unsigned   opt_maxNode;
+	/// @var {number} --jobs, number of workers refreshing stale fold candidates
+	unsigned   opt_jobs;
+	/// @var {number} --validate, validation policy for `groupTree_t`
+	unsigned   opt_validate;
 
 	/// @var {database_t} - Database store to place results
 	database_t *pStore;
@@ -105,16 +116,54 @@ struct gfoldContext_t {
 		opt_flagsClr     = 0;
 		opt_force        = 0;
 		opt_maxNode      = groupTree_t::DEFAULT_MAXNODE;
+		opt_jobs         = 0;
+		opt_validate     = groupTree_t::DEFAULT_VALIDATE;
+		pFolds           = NULL;
+		pFront           = NULL;
+		pBatch           = NULL;
+		batchSize        = 0;
+		numWorkers       = 0;
+		pWorkerPid       = NULL;
+		pWorkerCmd       = NULL;
+		foldVersion      = 0;
 		pStore           = NULL;
 	}
 
+	// worker commands, other values are keys of folds to replay
+	enum {
+		FOLD_SCORE = 0,          // score `pBatch[]`
+		FOLD_EXIT  = 0xffffffff, // terminate
+	};
+
 	// metrics for folds
 	struct fold_t {
-		uint32_t key;     // key to fold
-		uint32_t version; // version last computation
-		unsigned count;   // nodes in tree after folding
+		uint32_t key;          // key to fold
+		uint32_t version;      // version last computation
+		unsigned count;        // nodes in tree after folding
+		uint32_t batchVersion; // version of `batchCount`
+		unsigned batchCount;   // count scored ahead by workers
 	};
 
+	/// @var {fold_t[]} fold candidates, heap ordered
+	fold_t   *pFolds;
+	/// @var {number} round of fold candidate counts
+	uint32_t foldVersion;
+	/// @var {number[]} heap walk frontier for `scoreBatch()`
+	unsigned *pFront;
+
+	/// @var {fold_t[]} batch of candidates to score, shared with workers
+	fold_t   *pBatch;
+	/// @var {number} size of `pBatch[]` mapping
+	size_t   batchSize;
+	/// @var {number} number of running workers
+	unsigned numWorkers;
+	/// @var {pid_t[]} worker process ids
+	pid_t    *pWorkerPid;
+	/// @var {int[]} command pipes to workers
+	int      *pWorkerCmd;
+	/// @var {int[]} pipe workers announce completed batches
+	int      hDone[2];
+
 	/**
 	 * @date 2021-06-06 23:34:57
 	 *
@@ -136,6 +185,309 @@ struct gfoldContext_t {
 		return pFoldR->count - pFoldL->count;
 	}
 
+	/**
+	 * @date 2022-03-13 16:42:05
+	 *
+	 * Fold candidates are kept in a binary heap with the lowest count on top.
+	 * Ties are ordered by key to keep results reproducible.
+	 *
+	 * @param {fold_t} lhs - left hand side member
+	 * @param {fold_t} rhs - right hand side member
+	 * @return {boolean} `true` if "L<R"
+	 */
+	static inline bool foldLess(const fold_t &lhs, const fold_t &rhs) {
+		return lhs.count < rhs.count || (lhs.count == rhs.count && lhs.key < rhs.key);
+	}
+
+	/**
+	 * @date 2022-03-13 16:43:31
+	 *
+	 * Restore heap order after entry `iHeap` increased or got replaced
+	 *
+	 * @param {fold_t[]} pHeap - heap
+	 * @param {number} numHeap - number of entries
+	 * @param {number} iHeap - entry to move down
+	 */
+	static void foldSiftDown(fold_t *pHeap, unsigned numHeap, unsigned iHeap) {
+		fold_t item = pHeap[iHeap];
+
+		for (;;) {
+			unsigned iChild = 2 * iHeap + 1;
+
+			if (iChild >= numHeap)
+				break;
+			if (iChild + 1 < numHeap && foldLess(pHeap[iChild + 1], pHeap[iChild]))
+				iChild++;
+			if (!foldLess(pHeap[iChild], item))
+				break;
+
+			pHeap[iHeap] = pHeap[iChild];
+			iHeap = iChild;
+		}
+
+		pHeap[iHeap] = item;
+	}
+
+	/**
+	 * @date 2022-03-13 16:44:12
+	 *
+	 * Order all entries as heap
+	 *
+	 * @param {fold_t[]} pHeap - heap
+	 * @param {number} numHeap - number of entries
+	 */
+	static void foldHeapify(fold_t *pHeap, unsigned numHeap) {
+		for (unsigned iHeap = numHeap / 2; iHeap-- > 0;)
+			foldSiftDown(pHeap, numHeap, iHeap);
+	}
+
+	/**
+	 * @date 2022-03-14 01:06:17
+	 *
+	 * Fork `--jobs` workers that refresh stale fold candidates in the background.
+	 * Workers start with a private copy of `pNewTree` and `pTemp`,
+	 *   and keep in sync by replaying every fold the parent applies.
+	 * They receive commands through a pipe and exchange candidates through shared `pBatch[]`.
+	 *
+	 * @param {groupTree_t} pTemp - scratch tree
+	 * @param {groupTree_t} pNewTree - tree to fold
+	 * @param {number} numFolds - number of candidates
+	 */
+	void startWorkers(groupTree_t *pTemp, groupTree_t *pNewTree, unsigned numFolds) {
+		numWorkers = opt_jobs < numFolds ? opt_jobs : numFolds;
+		pWorkerPid = (pid_t *) ctx.myAlloc("gfoldContext_t::pWorkerPid", numWorkers, sizeof *pWorkerPid);
+		pWorkerCmd = (int *) ctx.myAlloc("gfoldContext_t::pWorkerCmd", numWorkers, sizeof *pWorkerCmd);
+
+		int hPipe[2];
+
+		// workers announce completed batches
+		if (pipe(hDone) != 0) {
+			json_t *jError = json_object();
+			json_object_set_new_nocheck(jError, "error", json_string_nocheck("pipe() failed"));
+			json_object_set_new_nocheck(jError, "reason", json_string(strerror(errno)));
+			ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		// flush before fork to avoid duplicate output
+		fflush(stdout);
+		fflush(stderr);
+
+		for (unsigned iJob = 0; iJob < numWorkers; iJob++) {
+			if (pipe(hPipe) != 0) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("pipe() failed"));
+				json_object_set_new_nocheck(jError, "reason", json_string(strerror(errno)));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+
+			pWorkerPid[iJob] = fork();
+			if (pWorkerPid[iJob] < 0) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("fork() failed"));
+				json_object_set_new_nocheck(jError, "reason", json_string(strerror(errno)));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+
+			if (pWorkerPid[iJob] == 0) {
+				/*
+				 * Worker
+				 */
+				close(hPipe[1]);
+				close(hDone[0]);
+				// only the parent may hold command pipes, workers exit when it dies
+				for (unsigned i = 0; i < iJob; i++)
+					close(pWorkerCmd[i]);
+
+				for (;;) {
+					uint32_t cmd;
+
+					if (read(hPipe[0], &cmd, sizeof cmd) != sizeof cmd)
+						_exit(1);
+
+					if (cmd == FOLD_EXIT) {
+						// do not run destructors or `atexit()` handlers
+						_exit(0);
+					} else if (cmd == FOLD_SCORE) {
+						// entry 0 holds the shared claim counter and batch size
+						for (;;) {
+							uint32_t iBatch = __sync_fetch_and_add(&pBatch[0].key, 1);
+							if (iBatch >= pBatch[0].count)
+								break;
+
+							pTemp->importFold(pNewTree, pBatch[1 + iBatch].key);
+							pBatch[1 + iBatch].count = pTemp->countActive();
+						}
+
+						if (write(hDone[1], &iJob, sizeof iJob) != sizeof iJob)
+							_exit(1);
+					} else {
+						// replay fold applied by parent
+						pTemp->importFold(pNewTree, cmd);
+						pNewTree->importActive(pTemp);
+					}
+				}
+			}
+
+			close(hPipe[0]);
+			pWorkerCmd[iJob] = hPipe[1];
+		}
+
+		// parent only reads
+		close(hDone[1]);
+	}
+
+	/**
+	 * @date 2022-03-14 01:07:02
+	 *
+	 * Send command to all workers
+	 *
+	 * @param {number} cmd - `FOLD_SCORE`, `FOLD_EXIT` or key of fold to replay
+	 */
+	void sendWorkers(uint32_t cmd) {
+		for (unsigned iJob = 0; iJob < numWorkers; iJob++) {
+			if (write(pWorkerCmd[iJob], &cmd, sizeof cmd) != sizeof cmd) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("write() failed"));
+				json_object_set_new_nocheck(jError, "job", json_integer(iJob));
+				json_object_set_new_nocheck(jError, "reason", json_string(strerror(errno)));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+		}
+	}
+
+	/**
+	 * @date 2022-03-14 01:07:29
+	 *
+	 * Stop and reap workers
+	 */
+	void stopWorkers(void) {
+		sendWorkers(FOLD_EXIT);
+
+		for (unsigned iJob = 0; iJob < numWorkers; iJob++) {
+			int status;
+
+			close(pWorkerCmd[iJob]);
+			if (waitpid(pWorkerPid[iJob], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("worker failed"));
+				json_object_set_new_nocheck(jError, "job", json_integer(iJob));
+				json_object_set_new_nocheck(jError, "status", json_integer(status));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+		}
+		close(hDone[0]);
+
+		ctx.myFree("gfoldContext_t::pWorkerPid", pWorkerPid);
+		ctx.myFree("gfoldContext_t::pWorkerCmd", pWorkerCmd);
+		pWorkerPid = NULL;
+		pWorkerCmd = NULL;
+		numWorkers = 0;
+	}
+
+	/**
+	 * @date 2022-03-14 01:08:11
+	 *
+	 * Let workers score the stale candidates the lazy refresh is most likely to visit next.
+	 * These are the lowest stale entries in heap order, up to the first current entry.
+	 * Results are kept aside in `batchCount` and only applied when the entry reaches the top,
+	 *   so the selected folds are exactly those of the serial refresh.
+	 *
+	 * @param {fold_t[]} pHeap - heap
+	 * @param {number} numHeap - number of entries
+	 */
+	void scoreBatch(fold_t *pHeap, unsigned numHeap) {
+		unsigned numBatch = 0;
+		unsigned numFront = 0;
+
+		// walk heap in increasing order, `pFront[]` holds the frontier
+		pFront[numFront++] = 0;
+
+		while (numFront > 0 && numBatch < numWorkers) {
+			unsigned iBest = 0;
+
+			for (unsigned i = 1; i < numFront; i++) {
+				if (foldLess(pHeap[pFront[i]], pHeap[pFront[iBest]]))
+					iBest = i;
+			}
+
+			unsigned iHeap = pFront[iBest];
+			pFront[iBest] = pFront[--numFront];
+
+			// entries beyond a current one are never refreshed
+			if (pHeap[iHeap].version == foldVersion)
+				break;
+
+			if (pHeap[iHeap].batchVersion != foldVersion) {
+				pBatch[1 + numBatch].key   = pHeap[iHeap].key;
+				pBatch[1 + numBatch].count = iHeap;
+				numBatch++;
+			}
+
+			if (2 * iHeap + 1 < numHeap)
+				pFront[numFront++] = 2 * iHeap + 1;
+			if (2 * iHeap + 2 < numHeap)
+				pFront[numFront++] = 2 * iHeap + 2;
+		}
+
+		// remember heap positions, workers overwrite `count`
+		for (unsigned iBatch = 0; iBatch < numBatch; iBatch++)
+			pFront[iBatch] = pBatch[1 + iBatch].count;
+
+		pBatch[0].key   = 0;
+		pBatch[0].count = numBatch;
+		sendWorkers(FOLD_SCORE);
+
+		for (unsigned iJob = 0; iJob < numWorkers; iJob++) {
+			unsigned iDone;
+
+			if (read(hDone[0], &iDone, sizeof iDone) != sizeof iDone) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("worker failed"));
+				json_object_set_new_nocheck(jError, "reason", json_string(strerror(errno)));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+		}
+
+		for (unsigned iBatch = 0; iBatch < numBatch; iBatch++) {
+			fold_t *pFold = &pHeap[pFront[iBatch]];
+
+			pFold->batchCount   = pBatch[1 + iBatch].count;
+			pFold->batchVersion = foldVersion;
+		}
+	}
+
+	/**
+	 * @date 2022-03-14 01:08:54
+	 *
+	 * Update counts until the best candidate is current.
+	 * With workers, stale entries are scored ahead in batches by `scoreBatch()`.
+	 *
+	 * @param {groupTree_t} pTemp - scratch tree
+	 * @param {groupTree_t} pNewTree - tree to fold
+	 * @param {fold_t[]} pHeap - heap
+	 * @param {number} numHeap - number of entries
+	 */
+	void refreshFolds(groupTree_t *pTemp, groupTree_t *pNewTree, fold_t *pHeap, unsigned numHeap) {
+		while (pHeap[0].version != foldVersion) {
+			fold_t *pFold = &pHeap[0];
+
+			if (numWorkers && pFold->batchVersion != foldVersion)
+				scoreBatch(pHeap, numHeap);
+
+			if (pFold->batchVersion == foldVersion) {
+				pFold->count = pFold->batchCount;
+			} else {
+				pTemp->importFold(pNewTree, pFold->key);
+				pFold->count = pTemp->countActive();
+			}
+			pFold->version = foldVersion;
+
+//			printf("prefold %s active=%d numnodes=%d numFolds=%d\n", pNewTree->entryNames[pFold->key].c_str(), pFold->count, pTemp->ncount - pTemp->nstart, numHeap);
+
+			foldSiftDown(pHeap, numHeap, 0);
+		}
+	}
+
 	/**
 	 * @date 2021-06-05 21:42:11
 	 *
@@ -204,6 +556,27 @@ struct gfoldContext_t {
 		groupTree_t *pResults = new groupTree_t(ctx, *pStore, pOldTree->kstart, pOldTree->ostart, pOldTree->estart, pOldTree->estart/*nstart*/, opt_maxNode, ctx.flags);
 		groupTree_t *pTemp    = new groupTree_t(ctx, *pStore, pOldTree->kstart, pOldTree->ostart, pOldTree->estart, pOldTree->estart/*nstart*/, opt_maxNode, ctx.flags);
 
+		pNewTree->validate = opt_validate;
+		pResults->validate = opt_validate;
+		pTemp->validate    = opt_validate;
+
+		// fold candidates are the keys referenced by `pNewTree`
+		pNewTree->enableRefCount();
+		pFolds = (fold_t *) ctx.myAlloc("gfoldContext_t::pFolds", pNewTree->nstart, sizeof *pFolds);
+
+		if (opt_jobs > 1) {
+			// entry 0 holds the shared claim counter and batch size
+			batchSize = (pNewTree->nstart + 1) * sizeof *pBatch;
+			pBatch    = (fold_t *) mmap(NULL, batchSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+			if (pBatch == MAP_FAILED) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("mmap() failed"));
+				json_object_set_new_nocheck(jError, "reason", json_string(strerror(errno)));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+			pFront = (unsigned *) ctx.myAlloc("gfoldContext_t::pFront", pNewTree->nstart, sizeof *pFront);
+		}
+
 		/*
 		 * Setup entry/root names
 		 */
@@ -378,73 +751,55 @@ struct gfoldContext_t {
 				//////////////// below is tree rotation.
 
 				/*
-				 * Count/collect fold candidates
+				 * Collect fold candidates, `pNewTree` keeps live reference counts
 				 */
-				uint32_t *pNewRefCount = pNewTree->allocMap();
-				fold_t   lstFolds[pNewTree->nstart];
-				unsigned numFolds;
-
-				for (unsigned iEntry = 0; iEntry < pNewTree->nstart; iEntry++)
-					pNewRefCount[iEntry] = 0;
-
-				for (uint32_t iNewGroup = pNewTree->nstart; iNewGroup < pNewTree->ncount; iNewGroup++) {
+				unsigned numFolds = 0;
 
-					if (pNewTree->N[iNewGroup].gid != iNewGroup)
-						continue; // not a group header
-
-					uint32_t          jNewNode       = pNewTree->getBestNode(iNewGroup);
-					const groupNode_t *pNewNode      = pNewTree->N + jNewNode;
-					unsigned          numPlaceholder = pStore->signatures[pNewNode->sid].numPlaceholder;
-
-					for (unsigned iSlot = 0; iSlot < numPlaceholder; iSlot++) {
-						uint32_t id = pNewNode->slots[iSlot];
-						pNewRefCount[id]++;
-					}
-				}
-
-				// populate folds
-				numFolds = 0;
 				for (unsigned iEntry = pNewTree->kstart; iEntry < pNewTree->nstart; iEntry++) {
-					if (pNewRefCount[iEntry] > 0) {
-						lstFolds[numFolds].key     = iEntry;
-						lstFolds[numFolds].version = 0;
-						lstFolds[numFolds].count   = 1;
+					if (pNewTree->refCount[iEntry] > 0) {
+						pFolds[numFolds].key     = iEntry;
+						pFolds[numFolds].version = 0;
+						pFolds[numFolds].count   = 1;
+						pFolds[numFolds].batchVersion = 0;
 						numFolds++;
 					}
 				}
 
-				pNewTree->freeMap(pNewRefCount);
+				// order by increasing counts
+				foldHeapify(pFolds, numFolds);
 
-				// sort in order of decreasing counts
-				qsort_r(lstFolds, numFolds, sizeof *lstFolds, comparFold, this);
+				// workers score ahead for the folds of this node
+				if (opt_jobs > 1 && numFolds > 1)
+					startWorkers(pTemp, pNewTree, numFolds);
 
 				while (numFolds > 0) {
-					// update counts
-					while (numFolds > 0 && lstFolds[numFolds - 1].version == 0) {
-						fold_t *pFold = &lstFolds[numFolds - 1];
+					// counts of previous folds are outdated
+					++foldVersion;
 
-						pTemp->rewind();
-						pTemp->importFold(pNewTree, pFold->key);
-						pFold->count   = pTemp->countActive();
-						pFold->version = 1;
+					// update counts until best candidate is current
+					refreshFolds(pTemp, pNewTree, pFolds, numFolds);
 
-//						printf("prefold %s active=%d numnodes=%d numFolds=%d\n", pNewTree->entryNames[pFold->key].c_str(), pFold->count, pTemp->ncount - pTemp->nstart, numFolds);
-
-						qsort_r(lstFolds, numFolds, sizeof *lstFolds, comparFold, this);
-					}
-
-//					uint32_t iFold = lstFolds[numFolds - 1].key;
-//					printf("%d fold %s %d\n", numFolds, pNewTree->entryNames[iFold].c_str(), lstFolds[numFolds - 1].count);
+//					uint32_t iFold = pFolds[0].key;
+//					printf("%d fold %s %d\n", numFolds, pNewTree->entryNames[iFold].c_str(), pFolds[0].count);
 
-					pTemp->importFold(pNewTree, lstFolds[numFolds - 1].key);
+					pTemp->importFold(pNewTree, pFolds[0].key);
 //					printf("count=%u\n", pTemp->countActive());
 					pNewTree->importActive(pTemp);
 //					printf("%s count=%u\n", pNewTree->rootNames[iFold].c_str(), pNewTree->countActive());
 
-					--numFolds;
-					for (unsigned i = 0; i < numFolds; i++)
-						lstFolds[i].version = 0;
+					// remove from candidates
+					uint32_t iFold = pFolds[0].key;
+
+					pFolds[0] = pFolds[--numFolds];
+					foldSiftDown(pFolds, numFolds, 0);
+
+					// keep workers in sync
+					if (numWorkers && numFolds > 0)
+						sendWorkers(iFold);
 				}
+
+				if (numWorkers)
+					stopWorkers();
 			}
 
 		} else {
@@ -702,11 +1057,17 @@ struct gfoldContext_t {
 			pNewTree->roots[pOldTree->ncount + iRoot] = pNewTree->importNodes(pResults, pResults->roots[R & ~IBIT]) ^ (R & IBIT);
 		}
 
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+			fprintf(stderr, "[%s] cntValidate=%lu timeValidate=%.3f\n", ctx.timeAsString(),
+				pNewTree->cntValidateRun + pResults->cntValidateRun + pTemp->cntValidateRun,
+				pNewTree->timeValidate + pResults->timeValidate + pTemp->timeValidate);
+
 		/*
 		 * Copy result to new tree without extended roots
 		 */
 		delete pTemp;
 		pTemp = new groupTree_t(ctx, *pStore, pOldTree->kstart, pOldTree->ostart, pOldTree->estart, pOldTree->nstart, opt_maxNode, ctx.flags);
+		pTemp->validate = opt_validate;
 		pTemp->entryNames = pOldTree->entryNames;
 		pTemp->rootNames  = pOldTree->rootNames;
 		pTemp->importActive(pNewTree);
@@ -726,6 +1087,16 @@ struct gfoldContext_t {
 			printf("%s\n", json_dumps(jResult, JSON_PRESERVE_ORDER | JSON_COMPACT));
 		}
 
+		if (pBatch) {
+			munmap(pBatch, batchSize);
+			pBatch    = NULL;
+			batchSize = 0;
+			ctx.myFree("gfoldContext_t::pFront", pFront);
+			pFront = NULL;
+		}
+		ctx.myFree("gfoldContext_t::pFolds", pFolds);
+		pFolds = NULL;
+
 		pOldTree->freeMap(pNodeRefCount);
 		delete pOldTree;
 		delete pTemp;
@@ -817,9 +1188,11 @@ void usage(char *argv[], bool verbose) {
 	if (verbose) {
 		fprintf(stderr, "\t-D --database=<filename>   Database to query [default=%s]\n", app.opt_databaseName);
 		fprintf(stderr, "\t   --force\n");
+		fprintf(stderr, "\t   --jobs=<number>            Refresh stale fold candidates using workers [default=%d]\n", app.opt_jobs);
 		fprintf(stderr, "\t   --maxnode=<number> [default=%d]\n", app.opt_maxNode);
 		fprintf(stderr, "\t-q --quiet\n");
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
+		fprintf(stderr, "\t   --validate=<number>        Tree validation on tick, 0=off 1=sampled 2=full 3=background [default=%d]\n", app.opt_validate);
 		fprintf(stderr, "\t-v --verbose\n");
 		fprintf(stderr, "\t   --[no-]paranoid [default=%s]\n", ctx.flags & ctx.MAGICMASK_PARANOID ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]pure [default=%s]\n", ctx.flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
@@ -846,7 +1219,7 @@ int main(int argc, char *argv[]) {
 
 	for (;;) {
 		enum {
-			LO_HELP = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE,
+			LO_HELP = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE, LO_JOBS, LO_VALIDATE,
 			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE, LO_SHRINK, LO_NOSHRINK, LO_PIVOT3, LO_NOPIVOT3,
 			LO_DATABASE = 'D', LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
@@ -857,9 +1230,11 @@ int main(int argc, char *argv[]) {
 			{"debug",       1, 0, LO_DEBUG},
 			{"force",       0, 0, LO_FORCE},
 			{"help",        0, 0, LO_HELP},
+			{"jobs",        1, 0, LO_JOBS},
 			{"maxnode",     1, 0, LO_MAXNODE},
 			{"quiet",       2, 0, LO_QUIET},
 			{"timer",       1, 0, LO_TIMER},
+			{"validate",    1, 0, LO_VALIDATE},
 			{"verbose",     2, 0, LO_VERBOSE},
 			//
 			{"paranoid",    0, 0, LO_PARANOID},
@@ -912,6 +1287,9 @@ int main(int argc, char *argv[]) {
 		case LO_HELP:
 			usage(argv, true);
 			exit(0);
+		case LO_JOBS:
+			app.opt_jobs = (unsigned) strtoul(optarg, NULL, 10);
+			break;
 		case LO_MAXNODE:
 			app.opt_maxNode = (unsigned) strtoul(optarg, NULL, 10);
 			break;
@@ -921,6 +1299,9 @@ int main(int argc, char *argv[]) {
 		case LO_TIMER:
 			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
 			break;
+		case LO_VALIDATE:
+			app.opt_validate = (unsigned) strtoul(optarg, NULL, 10);
+			break;
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
 			break;
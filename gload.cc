@@ -157,6 +157,9 @@ struct gloadContext_t {
 
 		newTree.flags |= jsonTree.flags & context_t::MAGICMASK_SYSTEM;
 
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+			fprintf(stderr, "[%s] cntValidate=%lu timeValidate=%.3f\n", ctx.timeAsString(), newTree.cntValidateRun, newTree.timeValidate);
+
 		newTree.entryNames = jsonTree.entryNames;
 		newTree.rootNames  = jsonTree.rootNames;
 
@@ -52,6 +52,7 @@
 #include <string>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 #include <vector>
 
 #include "context.h"
@@ -59,8 +60,12 @@
 
 /*
  * Version number of data file
+ *
+ * @date 2022-03-13 20:11:48
+ * `groupNode_t` shrunk to 64 bytes. Files with `GROUPTREE_MAGIC_V1` are converted when loaded.
  */
-#define GROUPTREE_MAGIC 0x20220112
+#define GROUPTREE_MAGIC 0x20220313
+#define GROUPTREE_MAGIC_V1 0x20220112
 
 struct groupNode_t {
 
@@ -98,20 +103,15 @@ struct groupNode_t {
 	uint32_t next;
 
 	/*
-	 * Used for debuging to track the original node
+	 * Highest group id found in slots
 	 */
-	uint32_t oldId;
+	uint32_t hiSlotId;
 
 	/*
 	 * weight/score. Sum of weights of all references. Less is better
 	 */
 	double weight;
 
-	/*
-	 * Highest group id found in slots
-	 */
-	uint32_t hiSlotId;
-
 	/*
 	 * The signature describing the behaviour of the node
 	 */
@@ -128,6 +128,28 @@ struct groupNode_t {
 	 * @date 2022-01-09 03:42:50
 	 * `slots` MUST be last to maintain forward version compatibility. 
 	 */
+
+	/*
+	 * @date 2022-03-13 20:09:35
+	 * Exactly 64 bytes. With cache line aligned storage, every node occupies a single cache line.
+	 * The debug-only `oldId` moved to `groupTree_t::oldIds[]`.
+	 */
+};
+
+/*
+ * @date 2022-03-13 20:14:02
+ *
+ * Node layout of `GROUPTREE_MAGIC_V1` files, only used to convert them.
+ */
+struct groupNodeV1_t {
+	uint32_t gid;
+	uint32_t prev;
+	uint32_t next;
+	uint32_t oldId;
+	double   weight;
+	uint32_t hiSlotId;
+	uint32_t sid;
+	uint32_t slots[MAXSLOTS];
 };
 
 /*
@@ -150,9 +172,15 @@ struct versionMemory_t {
 		// bump
 		++version;
 
-		// clear version map when wraparound
+		/*
+		 * clear version map when wraparound
+		 *
+		 * @date 2022-03-13 22:51:06
+		 *
+		 * Memory is lazy, only pages touched since the previous clear are released.
+		 */
 		if (version == 0) {
-			::memset(mem, 0, numMemory * sizeof mem[0]);
+			context_t::myClearLazy(mem, numMemory * sizeof mem[0]);
 			++version;
 		}
 
@@ -283,13 +311,63 @@ struct groupTree_t {
 	#define GROUPTREE_DEFAULT_SPEED 3
 	#endif
 
+	/**
+	 * @date 2022-03-13 21:04:16
+	 *
+	 * Policy for the tree validation triggered by the progress tick during construction.
+	 * `validateTree()` is O(N) and with large trees would dominate construction time.
+	 *
+	 * 0 = off
+	 * 1 = sampled, each tick validates the next `GROUPTREE_DEFAULT_VALIDATESAMPLE` nodes.
+	 *     Only the group and orphan checks are sampled, the tree-wide forward loop detection never runs during construction.
+	 *     Use 2 or 3 when forward loops are suspected.
+	 * 2 = full, every `GROUPTREE_DEFAULT_VALIDATEINTERVAL` ticks
+	 * 3 = background, full validation of a forked snapshot every `GROUPTREE_DEFAULT_VALIDATEINTERVAL` ticks
+	 *
+	 * @constant {number} GROUPTREE_DEFAULT_VALIDATE
+	 */
+	#if !defined(GROUPTREE_DEFAULT_VALIDATE)
+	#define GROUPTREE_DEFAULT_VALIDATE 1
+	#endif
+
+	/**
+	 * Number of ticks between full validations
+	 *
+	 * @constant {number} GROUPTREE_DEFAULT_VALIDATEINTERVAL
+	 */
+	#if !defined(GROUPTREE_DEFAULT_VALIDATEINTERVAL)
+	#define GROUPTREE_DEFAULT_VALIDATEINTERVAL 60
+	#endif
+
+	/**
+	 * Number of nodes to validate per tick when sampling
+	 *
+	 * @constant {number} GROUPTREE_DEFAULT_VALIDATESAMPLE
+	 */
+	#if !defined(GROUPTREE_DEFAULT_VALIDATESAMPLE)
+	#define GROUPTREE_DEFAULT_VALIDATESAMPLE 100000
+	#endif
+
+	enum {
+		DEFAULT_EXPANDMEMBER     = GROUPTREE_DEFAULT_EXPANDMEMBER,
+		DEFAULT_MAXDEPTH         = GROUPTREE_DEFAULT_MAXDEPTH,
+		DEFAULT_MAXNODE          = GROUPTREE_DEFAULT_MAXNODE,
+		DEFAULT_SPEED            = GROUPTREE_DEFAULT_SPEED,
+		DEFAULT_VALIDATE         = GROUPTREE_DEFAULT_VALIDATE,
+		DEFAULT_VALIDATEINTERVAL = GROUPTREE_DEFAULT_VALIDATEINTERVAL,
+		DEFAULT_VALIDATESAMPLE   = GROUPTREE_DEFAULT_VALIDATESAMPLE,
+		MAXPOOLARRAY             = GROUPTREE_DEFAULT_MAXPOOLARRAY,
+		KERROR                   = 1, // N[0] is reserved for ZERO, N[1] is reserved for ERROR
+	};
+
+	/*
+	 * Validation policies, see `GROUPTREE_DEFAULT_VALIDATE`
+	 */
 	enum {
-		DEFAULT_EXPANDMEMBER = GROUPTREE_DEFAULT_EXPANDMEMBER,
-		DEFAULT_MAXDEPTH     = GROUPTREE_DEFAULT_MAXDEPTH,
-		DEFAULT_MAXNODE      = GROUPTREE_DEFAULT_MAXNODE,
-		DEFAULT_SPEED        = GROUPTREE_DEFAULT_SPEED,
-		MAXPOOLARRAY         = GROUPTREE_DEFAULT_MAXPOOLARRAY,
-		KERROR               = 1, // N[0] is reserved for ZERO, N[1] is reserved for ERROR
+		VALIDATE_OFF = 0,
+		VALIDATE_SAMPLE,
+		VALIDATE_FULL,
+		VALIDATE_BACKGROUND,
 	};
 
 	/*
@@ -322,6 +400,8 @@ struct groupTree_t {
 	unsigned                 maxDepth;              // Max node expansion depth
 	unsigned		 speed;			// Speed setting
 	bool			 useExpandMember;	// select between `expandSignature()`/`expandMember()`.
+	unsigned                 validate;              // validation policy, see `GROUPTREE_DEFAULT_VALIDATE`
+	unsigned                 validateInterval;      // ticks between full/background validations
 	// primary fields
 	uint32_t                 kstart;                // first input key id.
 	uint32_t                 ostart;                // first output key id.
@@ -336,6 +416,7 @@ struct groupTree_t {
 	std::vector<std::string> rootNames;             // sliced version of `rootNameData`
 	// primary storage
 	groupNode_t              *N;                    // nodes
+	uint32_t                 *oldIds;               // debug, original node id. Kept outside `N[]` to keep nodes cache line sized
 	uint32_t                 *roots;                // entry points. can be inverted. first estart entries should match keys
 	// history
 	uint32_t                 numHistory;            //
@@ -355,6 +436,19 @@ struct groupTree_t {
 	uint32_t                 *slotMap;              // slot position of endpoint 
 	uint32_t                 *slotVersion;          // versioned memory for addNormaliseNode - content version
 	uint32_t                 slotVersionNr;         // active version number
+	// `constructSlots()` Q/T stage of previous call
+	const groupNode_t        *qtNodeQ;              // Q node
+	const groupNode_t        *qtNodeT;              // T node
+	uint32_t                 qtSidQ;                // sid of Q
+	uint32_t                 qtSidT;                // sid of T, including Ti
+	uint32_t                 qtVersion;             // `slotVersion[]` of Q/T endpoints, 0 if nothing cached
+	uint32_t                 qtIdFirst;             // `patternFirst` lookup result
+	unsigned                 qtNextSlot;            // slotsR entries in use
+	uint32_t                 qtSlotsR[MAXSLOTS];    // resulting slots
+	uint32_t                 qtEndpointQ[MAXSLOTS]; // latest of Q slots
+	uint32_t                 qtEndpointT[MAXSLOTS]; // latest of T slots
+	// reference counting
+	uint32_t                 *refCount;             // optional live reference counts, see `enableRefCount()`
 	// statistics
 	uint64_t                 cntOutdated;           // `constructSlots()` detected and updated outdated Q/T/F
 	uint64_t                 cntRestart;            // C-product got confused, restart  
@@ -368,6 +462,12 @@ struct groupTree_t {
 	uint32_t                 cntUpdateGroup;        // number of calls to `updateGroup()`
 	uint32_t                 cntValidate;           // counter of last valid tree
 	uint32_t                 cntCproduct;           // counter number of Cproduct iterations
+	// validation
+	uint32_t                 validatePos;           // next node for sampled validation
+	unsigned                 validateTicks;         // ticks since last full/background validation
+	pid_t                    validatePid;           // pid of pending background validation
+	uint64_t                 cntValidateRun;        // number of validations
+	double                   timeValidate;          // seconds spent validating
 	//
 	uint32_t		 overflowGroup;		// group causing overflow
 
@@ -396,6 +496,8 @@ struct groupTree_t {
 		maxDepth(DEFAULT_MAXDEPTH),
 		speed(DEFAULT_SPEED),
 		useExpandMember(DEFAULT_EXPANDMEMBER),
+		validate(DEFAULT_VALIDATE),
+		validateInterval(DEFAULT_VALIDATEINTERVAL),
 		// primary fields
 		kstart(0),
 		ostart(0),
@@ -410,6 +512,7 @@ struct groupTree_t {
 		rootNames(),
 		// primary storage (allocated by storage context)
 		N(NULL),
+		oldIds(NULL),
 		roots(NULL),
 		// history
 		numHistory(0),
@@ -429,6 +532,15 @@ struct groupTree_t {
 		slotMap(NULL),
 		slotVersion(NULL),
 		slotVersionNr(1),
+		qtNodeQ(NULL),
+		qtNodeT(NULL),
+		qtSidQ(0),
+		qtSidT(0),
+		qtVersion(0),
+		qtIdFirst(0),
+		qtNextSlot(0),
+		// reference counting
+		refCount(NULL),
 		// statistics
 		cntOutdated(0),
 		cntRestart(0),
@@ -442,8 +554,15 @@ struct groupTree_t {
 		cntUpdateGroup(0),
 		cntValidate(0),
 		cntCproduct(0),
+		validatePos(0),
+		validateTicks(0),
+		validatePid(0),
+		cntValidateRun(0),
+		timeValidate(0),
 		overflowGroup(0)
 	{
+		// compiled signatures for `evalNode()`
+		db.compileSignatures();
 	}
 
 	/*
@@ -462,6 +581,8 @@ struct groupTree_t {
 		maxDepth(DEFAULT_MAXDEPTH),
 		speed(DEFAULT_SPEED),
 		useExpandMember(DEFAULT_EXPANDMEMBER),
+		validate(DEFAULT_VALIDATE),
+		validateInterval(DEFAULT_VALIDATEINTERVAL),
 		// primary fields
 		kstart(kstart),
 		ostart(ostart),
@@ -476,6 +597,7 @@ struct groupTree_t {
 		rootNames(),
 		// primary storage (allocated by storage context)
 		N((groupNode_t *) ctx.myAlloc("groupTree_t::N", maxNodes, sizeof *N)),
+		oldIds((uint32_t *) ctx.myAlloc("groupTree_t::oldIds", maxNodes, sizeof *oldIds)),
 		roots((uint32_t *) ctx.myAlloc("groupTree_t::roots", maxNodes, sizeof *roots)),
 		// history
 		numHistory(0),
@@ -483,8 +605,8 @@ struct groupTree_t {
 		history((uint32_t *) ctx.myAlloc("groupTree_t::history", nstart, sizeof *history)),
 		// node index  NOTE: reserve 4G for the node+version index
 		nodeIndexSize(536870879), // first prime number before 0x20000000-8 (so that 4*this does not exceed 0x80000000-32),
-		nodeIndex((uint32_t *) ctx.myAlloc("groupTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
-		nodeIndexVersion((uint32_t *) ctx.myAlloc("groupTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
+		nodeIndex((uint32_t *) ctx.myAllocLazy("groupTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
+		nodeIndexVersion((uint32_t *) ctx.myAllocLazy("groupTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
 		nodeIndexVersionNr(1), // own version because longer life span
 		// pools
 		numPoolMap(0),
@@ -495,6 +617,15 @@ struct groupTree_t {
 		slotMap(allocMap()),
 		slotVersion(allocMap()),  // allocate as node-id map because of local version numbering
 		slotVersionNr(1),
+		qtNodeQ(NULL),
+		qtNodeT(NULL),
+		qtSidQ(0),
+		qtSidT(0),
+		qtVersion(0),
+		qtIdFirst(0),
+		qtNextSlot(0),
+		// reference counting
+		refCount(NULL),
 		// statistics
 		cntOutdated(0),
 		cntRestart(0),
@@ -508,6 +639,11 @@ struct groupTree_t {
 		cntUpdateGroup(0),
 		cntValidate(0),
 		cntCproduct(0),
+		validatePos(0),
+		validateTicks(0),
+		validatePid(0),
+		cntValidateRun(0),
+		timeValidate(0),
 		overflowGroup()
 	{
 		if (this->N)
@@ -519,6 +655,9 @@ struct groupTree_t {
 		if (this->nodeIndex)
 			allocFlags |= ALLOCMASK_INDEX;
 
+		// compiled signatures for `evalNode()`
+		db.compileSignatures();
+
 		// make all `entryNames`+`rootNames` indices valid
 		entryNames.resize(nstart - kstart);
 
@@ -559,6 +698,8 @@ struct groupTree_t {
 		maxDepth(DEFAULT_MAXDEPTH),
 		speed(DEFAULT_SPEED),
 		useExpandMember(DEFAULT_EXPANDMEMBER),
+		validate(DEFAULT_VALIDATE),
+		validateInterval(DEFAULT_VALIDATEINTERVAL),
 		// primary fields
 		kstart(0),
 		ostart(0),
@@ -573,6 +714,7 @@ struct groupTree_t {
 		rootNames(),
 		// primary storage (allocated by storage context)
 		N((groupNode_t *) ctx.myAlloc("groupTree_t::N", maxNodes, sizeof *N)),
+		oldIds((uint32_t *) ctx.myAlloc("groupTree_t::oldIds", maxNodes, sizeof *oldIds)),
 		roots((uint32_t *) ctx.myAlloc("groupTree_t::roots", maxNodes, sizeof *roots)),
 		// history
 		numHistory(0),
@@ -580,8 +722,8 @@ struct groupTree_t {
 		history((uint32_t *) ctx.myAlloc("groupTree_t::history", nstart, sizeof *history)),
 		// node index  NOTE: reserve 4G for the node+version index
 		nodeIndexSize(536870879), // first prime number before 0x20000000-8 (so that 4*this does not exceed 0x80000000-32),
-		nodeIndex((uint32_t *) ctx.myAlloc("groupTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
-		nodeIndexVersion((uint32_t *) ctx.myAlloc("groupTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
+		nodeIndex((uint32_t *) ctx.myAllocLazy("groupTree_t::nodeIndex", nodeIndexSize, sizeof *nodeIndex)),
+		nodeIndexVersion((uint32_t *) ctx.myAllocLazy("groupTree_t::nodeIndexVersion", nodeIndexSize, sizeof *nodeIndexVersion)),
 		nodeIndexVersionNr(1), // own version because longer life span
 		// pools
 		numPoolMap(0),
@@ -592,6 +734,15 @@ struct groupTree_t {
 		slotMap(allocMap()),
 		slotVersion(allocMap()),  // allocate as node-id map because of local version numbering
 		slotVersionNr(1),
+		qtNodeQ(NULL),
+		qtNodeT(NULL),
+		qtSidQ(0),
+		qtSidT(0),
+		qtVersion(0),
+		qtIdFirst(0),
+		qtNextSlot(0),
+		// reference counting
+		refCount(NULL),
 		// statistics
 		cntOutdated(0),
 		cntRestart(0),
@@ -605,8 +756,16 @@ struct groupTree_t {
 		cntUpdateGroup(0),
 		cntValidate(0),
 		cntCproduct(0),
+		validatePos(0),
+		validateTicks(0),
+		validatePid(0),
+		cntValidateRun(0),
+		timeValidate(0),
 		overflowGroup()
 	{
+		// compiled signatures for `evalNode()`
+		db.compileSignatures();
+
 		/*
 		 * Create Load string
 		 */
@@ -640,8 +799,8 @@ struct groupTree_t {
 			pNode->slots[0] = iEntry;
 		}
 
-		// load string with separate roots
-		uint32_t *pRoots = allocMap();
+		// load string with separate roots, there are no more roots than characters
+		uint32_t *pRoots = (uint32_t *) ctx.myAlloc("groupTree_t::pRoots", strlen(pName) + 1, sizeof *pRoots);
 
 		if (pTransform) {
 			this->numRoots = this->loadStringSafe(pName, pTransform + 1, pRoots);
@@ -682,7 +841,7 @@ struct groupTree_t {
 			this->roots[iRoot] = pRoots[iRoot];
 		}
 
-		freeMap(pRoots);
+		ctx.myFree("groupTree_t::pRoots", pRoots);
 
 		/*
 		 * finalise
@@ -702,6 +861,10 @@ struct groupTree_t {
 	 * Release system resources
 	 */
 	virtual ~groupTree_t() {
+		// collect pending background validation
+		if (validatePid)
+			reapValidate(true);
+
 		// check if entrypoints are compromised
 		if (this->N) {
 			assert(this->N[0].gid == 0);
@@ -720,13 +883,15 @@ struct groupTree_t {
 		// release allocations if not mmapped
 		if (allocFlags & ALLOCMASK_NODES)
 			ctx.myFree("groupTree_t::N", this->N);
+		if (oldIds)
+			ctx.myFree("groupTree_t::oldIds", this->oldIds);
 		if (allocFlags & ALLOCMASK_ROOTS)
 			ctx.myFree("groupTree_t::roots", this->roots);
 		if (allocFlags & ALLOCMASK_HISTORY)
 			ctx.myFree("groupTree_t::history", this->history);
 		if (allocFlags & ALLOCMASK_INDEX) {
-			ctx.myFree("groupTree_t::nodeIndex", this->nodeIndex);
-			ctx.myFree("groupTree_t::nodeIndexVersion", this->nodeIndexVersion);
+			ctx.myFreeLazy("groupTree_t::nodeIndex", this->nodeIndex, nodeIndexSize, sizeof(*nodeIndex));
+			ctx.myFreeLazy("groupTree_t::nodeIndexVersion", this->nodeIndexVersion, nodeIndexSize, sizeof(*nodeIndexVersion));
 		}
 
 		// release maps
@@ -734,12 +899,16 @@ struct groupTree_t {
 			freeMap(slotMap);
 		if (slotVersion)
 			freeMap(slotVersion);
+		if (refCount)
+			ctx.myFree("groupTree_t::refCount", refCount);
 
 		// release pools
 		while (numPoolMap > 0)
-			ctx.myFree("groupTree_t::nodeMap", pPoolMap[--numPoolMap]);
-		while (numPoolVersion > 0)
-			ctx.myFree("groupTree_t::versionMap", pPoolVersion[--numPoolVersion]);
+			ctx.myFreeLazy("groupTree_t::nodeMap", pPoolMap[--numPoolMap], maxNodes, sizeof(**pPoolMap));
+		while (numPoolVersion > 0) {
+			versionMemory_t *pVersion = pPoolVersion[--numPoolVersion];
+			ctx.myFreeLazy("groupTree_t::versionMap", pVersion, 1, sizeof(*pVersion) + pVersion->numMemory * sizeof(pVersion->mem[0]));
+		}
 
 		// release resources
 		if (hndl >= 0) {
@@ -764,6 +933,7 @@ struct groupTree_t {
 		rawData          = NULL;
 		fileHeader       = NULL;
 		N                = NULL;
+		oldIds           = NULL;
 		roots            = NULL;
 		history          = NULL;
 		nodeIndex        = NULL;
@@ -772,6 +942,7 @@ struct groupTree_t {
 		pPoolVersion     = NULL;
 		slotMap          = NULL;
 		slotVersion      = NULL;
+		refCount         = NULL;
 	}
 
 	/*
@@ -784,6 +955,39 @@ struct groupTree_t {
 		this->numRoots = 0;
 		// invalidate lookup cache
 		++this->nodeIndexVersionNr;
+		// release references
+		if (this->refCount) {
+			for (uint32_t iEntry = 0; iEntry < this->nstart; iEntry++)
+				this->refCount[iEntry] = 0;
+		}
+	}
+
+	/*
+	 * @date 2022-03-13 14:19:52
+	 *
+	 * Enable live reference counting.
+	 * `newNode()` adds the slot references of every created node and `rewind()` releases them.
+	 * Counts include alternatives and nodes of outdated groups, only entrypoints are exact.
+	 * A key with a zero count is certainly not used by the tree.
+	 */
+	void enableRefCount(void) {
+		if (!this->refCount)
+			this->refCount = (uint32_t *) ctx.myAlloc("groupTree_t::refCount", maxNodes, sizeof *refCount);
+
+		for (uint32_t iNode = 0; iNode < this->ncount; iNode++)
+			this->refCount[iNode] = 0;
+
+		for (uint32_t iNode = this->nstart; iNode < this->ncount; iNode++) {
+			const groupNode_t *pNode = this->N + iNode;
+
+			if (pNode->sid == db.SID_SELF)
+				continue;
+
+			unsigned numPlaceholder = db.signatures[pNode->sid].numPlaceholder;
+
+			for (unsigned iSlot = 0; iSlot < numPlaceholder; iSlot++)
+				this->refCount[pNode->slots[iSlot]]++;
+		}
 	}
 
 	/*
@@ -808,6 +1012,10 @@ struct groupTree_t {
 	 * Allocate a map that can hold node id's
 	 * Returned map is uninitialised
 	 *
+	 * @date 2022-03-13 22:51:14
+	 *
+	 * Maps are lazy, physical memory is only claimed for the node id's that get touched.
+	 *
 	 * @return {uint32_t*} - Uninitialised map for node id's
 	 */
 	uint32_t *allocMap(void) {
@@ -818,7 +1026,7 @@ struct groupTree_t {
 			pMap = pPoolMap[--numPoolMap];
 		} else {
 			// allocate new map
-			pMap = (uint32_t *) ctx.myAlloc("groupTree_t::versionMap", maxNodes, sizeof *pMap);
+			pMap = (uint32_t *) ctx.myAllocLazy("groupTree_t::nodeMap", maxNodes, sizeof *pMap);
 		}
 
 		return pMap;
@@ -859,7 +1067,7 @@ struct groupTree_t {
 			pVersion = pPoolVersion[--numPoolVersion];
 		} else {
 			// allocate new map
-			pVersion = (versionMemory_t *) ctx.myAlloc("groupTree_t::versionMap", maxNodes + sizeof(versionMemory_t), sizeof(*pVersion));
+			pVersion = (versionMemory_t *) ctx.myAllocLazy("groupTree_t::versionMap", 1, sizeof(*pVersion) + maxNodes * sizeof(pVersion->mem[0]));
 			pVersion->version   = 0;
 			pVersion->numMemory = maxNodes;
 		}
@@ -1107,7 +1315,7 @@ struct groupTree_t {
 		pNode->gid      = IBIT;
 		pNode->next     = nid;
 		pNode->prev     = nid;
-		pNode->oldId    = 0;
+		this->oldIds[nid] = 0;
 		pNode->weight   = weight;
 		pNode->hiSlotId = 0;
 		pNode->sid      = sid;
@@ -1122,6 +1330,18 @@ struct groupTree_t {
 				pNode->hiSlotId = id;
 		}
 
+		// update references
+		if (this->refCount) {
+			this->refCount[nid] = 0;
+
+			if (sid != db.SID_SELF) {
+				unsigned numPlaceholder = db.signatures[sid].numPlaceholder;
+
+				for (unsigned iSlot = 0; iSlot < numPlaceholder; iSlot++)
+					this->refCount[slots[iSlot]]++;
+			}
+		}
+
 		/*
 		 * @date 2022-01-26 15:54:07
 		 * For 1n9, do an exact node count
@@ -1997,13 +2217,21 @@ struct groupTree_t {
 		 * Any collapses will result in an early return with the current group being orphaned
 		 */
 
-		// bump versioned memory
-		uint32_t thisVersion = ++slotVersionNr;
-		if (thisVersion == 0) {
+		/*
+		 * @date 2022-03-13 22:05:17
+		 *
+		 * The Cartesian product advances F fastest, making the Q/T stage mostly identical to that of the previous call.
+		 * Reuse it when Q/T and the latest of their endpoints are unchanged.
+		 * Q/T endpoints are marked with `qtVersion`, F endpoints with `thisVersion`.
+		 */
+
+		// bump versioned memory, reserve two versions
+		if (slotVersionNr >= 0xfffffffd) {
 			// version overflow, clear
-			memset(slotVersion, 0, this->maxNodes * sizeof(*slotVersion));
+			context_t::myClearLazy(slotVersion, this->maxNodes * sizeof(*slotVersion));
 
-			thisVersion = ++slotVersionNr;
+			slotVersionNr = 0;
+			qtVersion     = 0;
 		}
 
 		/*
@@ -2021,89 +2249,139 @@ struct groupTree_t {
 		// slotsR entries in use
 		unsigned          nextSlot = 0;
 		const signature_t *pSignature;
+		uint32_t          thisVersion;
+		uint32_t          idFirst;
 
-		/*
-		 * Slot population as `groupTree_t` would do
-		 */
+		// can previous Q/T stage be reused
+		bool reuse = (qtVersion != 0 && pNodeQ == qtNodeQ && pNodeT == qtNodeT && pNodeQ->sid == qtSidQ && (pNodeT->sid ^ Ti) == qtSidT);
 
-		// NOTE: `slotsQ` is always `tid=0`, so `slotsQ[]` is not needed, load directly into `slotsR[]`.
-		pSignature = db.signatures + pNodeQ->sid;
-		for (unsigned iSlot = 0; iSlot < pSignature->numPlaceholder; iSlot++) {
-			// get slot value
-			uint32_t endpoint = updateToLatest(pNodeQ->slots[iSlot]);
-			assert(endpoint != 0);
+		if (reuse) {
+			pSignature = db.signatures + pNodeQ->sid;
+			for (unsigned iSlot = 0; reuse && iSlot < pSignature->numPlaceholder; iSlot++)
+				reuse = (updateToLatest(pNodeQ->slots[iSlot]) == qtEndpointQ[iSlot]);
 
-			// is it an endpoint-collapse
-			if (endpoint == layer.gid) {
-				// yes
-				pFinal[0] = endpoint;
-				return db.SID_SELF;
-			}
+			pSignature = db.signatures + pNodeT->sid;
+			for (unsigned iSlot = 0; reuse && iSlot < pSignature->numPlaceholder; iSlot++)
+				reuse = (updateToLatest(pNodeT->slots[iSlot]) == qtEndpointT[iSlot]);
 
-			// was it seen before
-			if (slotVersion[endpoint] != thisVersion) {
-				slotVersion[endpoint] = thisVersion;
-				slotMap[endpoint]     = 'a' + nextSlot; // assign new placeholder
-				slotsR[nextSlot]      = endpoint; // put endpoint in result
-				nextSlot++;
-			} else {
-				/*
-				 * @date 2021-12-09 03:02:42
-				 * duplicate id in Q
-				 * This because Q doesn't go through `lookupFwdTransform()` 
-				 */
-				return 0;
-			}
+			// endpoint-collapse or `slotMap[]` overwritten
+			for (unsigned iSlot = 0; reuse && iSlot < qtNextSlot; iSlot++)
+				reuse = (qtSlotsR[iSlot] != layer.gid && slotVersion[qtSlotsR[iSlot]] == qtVersion);
 		}
 
-		pSignature = db.signatures + pNodeT->sid;
-		for (unsigned iSlot = 0; iSlot < pSignature->numPlaceholder; iSlot++) {
-			// get slot value
-			uint32_t endpoint = updateToLatest(pNodeT->slots[iSlot]);
-			assert(endpoint != 0);
+		if (reuse) {
+			for (nextSlot = 0; nextSlot < qtNextSlot; nextSlot++)
+				slotsR[nextSlot] = qtSlotsR[nextSlot];
+			idFirst = qtIdFirst;
 
-			// is it an endpoint-collapse
-			if (endpoint == layer.gid) {
-				// yes
-				pFinal[0] = endpoint;
-				return db.SID_SELF;
+			if (idFirst == 0)
+				return 0; // not found
+
+			thisVersion = ++slotVersionNr;
+
+		} else {
+			qtVersion   = 0; // invalidate
+			thisVersion = ++slotVersionNr;
+
+			/*
+			 * Slot population as `groupTree_t` would do
+			 */
+
+			// NOTE: `slotsQ` is always `tid=0`, so `slotsQ[]` is not needed, load directly into `slotsR[]`.
+			pSignature = db.signatures + pNodeQ->sid;
+			for (unsigned iSlot = 0; iSlot < pSignature->numPlaceholder; iSlot++) {
+				// get slot value
+				uint32_t endpoint = updateToLatest(pNodeQ->slots[iSlot]);
+				assert(endpoint != 0);
+				qtEndpointQ[iSlot] = endpoint;
+
+				// is it an endpoint-collapse
+				if (endpoint == layer.gid) {
+					// yes
+					pFinal[0] = endpoint;
+					return db.SID_SELF;
+				}
+
+				// was it seen before
+				if (slotVersion[endpoint] != thisVersion) {
+					slotVersion[endpoint] = thisVersion;
+					slotMap[endpoint]     = 'a' + nextSlot; // assign new placeholder
+					slotsR[nextSlot]      = endpoint; // put endpoint in result
+					nextSlot++;
+				} else {
+					/*
+					 * @date 2021-12-09 03:02:42
+					 * duplicate id in Q
+					 * This because Q doesn't go through `lookupFwdTransform()` 
+					 */
+					return 0;
+				}
 			}
 
-			// was it seen before
-			if (slotVersion[endpoint] != thisVersion) {
-				if (nextSlot >= MAXSLOTS)
-					return 0; // overflow
-				slotVersion[endpoint] = thisVersion;
-				slotMap[endpoint]     = 'a' + nextSlot;
-				slotsR[nextSlot]      = endpoint;
-				nextSlot++;
+			pSignature = db.signatures + pNodeT->sid;
+			for (unsigned iSlot = 0; iSlot < pSignature->numPlaceholder; iSlot++) {
+				// get slot value
+				uint32_t endpoint = updateToLatest(pNodeT->slots[iSlot]);
+				assert(endpoint != 0);
+				qtEndpointT[iSlot] = endpoint;
+
+				// is it an endpoint-collapse
+				if (endpoint == layer.gid) {
+					// yes
+					pFinal[0] = endpoint;
+					return db.SID_SELF;
+				}
+
+				// was it seen before
+				if (slotVersion[endpoint] != thisVersion) {
+					if (nextSlot >= MAXSLOTS)
+						return 0; // overflow
+					slotVersion[endpoint] = thisVersion;
+					slotMap[endpoint]     = 'a' + nextSlot;
+					slotsR[nextSlot]      = endpoint;
+					nextSlot++;
+				}
+				slotsT[iSlot] = (char) slotMap[endpoint];
 			}
-			slotsT[iSlot] = (char) slotMap[endpoint];
-		}
-		slotsT[pSignature->numPlaceholder] = 0;
+			slotsT[pSignature->numPlaceholder] = 0;
 
-		// order slots
-		if (pSignature->swapId)
-			applySwapping(pNodeT->sid, slotsT);
+			// order slots
+			if (pSignature->swapId)
+				applySwapping(pNodeT->sid, slotsT);
 
-		/*
-		 * Lookup `patternFirst`
-		 * 
-		 * @date 2021-12-09 03:04:00
-		 * Instead of doing complicated to detect duplicate latest in T, just check if the transform is valid
-		 */
+			/*
+			 * Lookup `patternFirst`
+			 * 
+			 * @date 2021-12-09 03:04:00
+			 * Instead of doing complicated to detect duplicate latest in T, just check if the transform is valid
+			 */
 
-		uint32_t tidSlotT = db.lookupFwdTransform(slotsT);
-		if (tidSlotT == IBIT) {
-			this->cntOutdated++;
-			return 0; // invalid slots (duplicate entries)
-		}
+			uint32_t tidSlotT = db.lookupFwdTransform(slotsT);
+			if (tidSlotT == IBIT) {
+				this->cntOutdated++;
+				return 0; // invalid slots (duplicate entries)
+			}
 
-		uint32_t ixFirst = db.lookupPatternFirst(pNodeQ->sid, pNodeT->sid ^ Ti, tidSlotT);
-		uint32_t idFirst = db.patternFirstIndex[ixFirst];
+			uint32_t ixFirst = db.lookupPatternFirst(pNodeQ->sid, pNodeT->sid ^ Ti, tidSlotT);
+			idFirst = db.patternFirstIndex[ixFirst];
 
-		if (idFirst == 0)
-			return 0; // not found
+			// save Q/T stage
+			qtNodeQ    = pNodeQ;
+			qtNodeT    = pNodeT;
+			qtSidQ     = pNodeQ->sid;
+			qtSidT     = pNodeT->sid ^ Ti;
+			qtVersion  = thisVersion;
+			qtIdFirst  = idFirst;
+			qtNextSlot = nextSlot;
+			for (unsigned iSlot = 0; iSlot < nextSlot; iSlot++)
+				qtSlotsR[iSlot] = slotsR[iSlot];
+
+			if (idFirst == 0)
+				return 0; // not found
+
+			// F stage
+			thisVersion = ++slotVersionNr;
+		}
 
 		/*
 		 * Add `F` to slots
@@ -2123,7 +2401,7 @@ struct groupTree_t {
 			}
 
 			// was it seen before
-			if (slotVersion[endpoint] != thisVersion) {
+			if (slotVersion[endpoint] != thisVersion && slotVersion[endpoint] != qtVersion) {
 				if (nextSlot >= MAXSLOTS)
 					return 0; // overflow
 				slotVersion[endpoint] = thisVersion;
@@ -2244,128 +2522,26 @@ struct groupTree_t {
 		assert(layer.gid == IBIT || layer.gid == this->N[layer.gid].gid);
 
 		/*
-		 * init
-		 */
-
-		unsigned numStack = 0;
-		uint32_t nextNode = this->nstart;
-		uint32_t *pStack  = allocMap(); // evaluation stack
-		uint32_t *pMap    = allocMap(); // node id of intermediates
-
-		/*
-		 * Load string
+		 * @date 2022-03-13 21:42:31
+		 * Instantiate the compiled signature instead of parsing its name.
+		 * Registers: zero, slots, followed by component results.
 		 */
-		for (const char *pattern = pSignature->name; *pattern; pattern++) {
-
-			uint32_t Q, T, F;
-
-			switch (*pattern) {
-			case '0': //
-				/*
-				 * Push zero
-				 */
-				assert (numStack < maxNodes);
-				pStack[numStack++] = 0;
-				continue; // for
-
-				// @formatter:off
-			case '1': case '2': case '3':
-			case '4': case '5': case '6':
-			case '7': case '8': case '9':
-				// @formatter:on
-			{
-				/*
-				 * Push back-reference
-				 */
-				uint32_t v = nextNode - (*pattern - '0');
-
-				assert (v >= this->nstart && v < nextNode);
-
-				assert (numStack < maxNodes);
-				pStack[numStack++] = pMap[v];
-				continue; // for
-			}
-
-				// @formatter:off
-			case 'a': case 'b': case 'c': case 'd':
-			case 'e': case 'f': case 'g': case 'h':
-			case 'i': case 'j': case 'k': case 'l':
-			case 'm': case 'n': case 'o': case 'p':
-			case 'q': case 'r': case 's': case 't':
-			case 'u': case 'v': case 'w': case 'x':
-			case 'y': case 'z':
-				// @formatter:on
-			{
-				/*
-				 * Push endpoint
-				 */
-				uint32_t v = (*pattern - 'a');
-
-				assert(v < numPlaceholder);
-
-				assert (numStack < maxNodes);
-				pStack[numStack++] = pSlots[v];
-				continue; // for
-
-			}
-
-			case '+': {
-				// OR (appreciated)
-				assert(numStack >= 2);
-
-				F  = pStack[--numStack];
-				T = IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '>': {
-				// GT (appreciated)
-				assert(numStack >= 2);
-
-				F  = 0;
-				T = pStack[--numStack] ^ IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '^': {
-				// XOR/NE (appreciated)
-				assert(numStack >= 2);
+		assert(sid < db.numSignatureCode);
+		const signatureCode_t *pCode = db.signatureCodes + sid;
+		uint32_t              reg[signatureCode_t::REG_NODE + signatureCode_t::MAXCODE];
 
-				F  = pStack[--numStack];
-				T = F ^ IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '!': {
-				// QnTF (appreciated)
-				assert(numStack >= 3);
+		reg[0] = 0;
+		for (unsigned iSlot = 0; iSlot < numPlaceholder; iSlot++)
+			reg[1 + iSlot] = pSlots[iSlot];
 
-				F  = pStack[--numStack];
-				T = pStack[--numStack] ^ IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '&': {
-				// AND (depreciated)
-				assert(numStack >= 2);
+		for (unsigned iCode = 0; iCode < pCode->numCode; iCode++) {
 
-				F  = 0;
-				T = pStack[--numStack];
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '?': {
-				// QTF (depreciated)
-				assert(numStack >= 3);
+			uint32_t Q = reg[pCode->code[iCode].Q];
+			uint32_t T = reg[pCode->code[iCode].T & ~signatureCode_t::T_INVERT];
+			uint32_t F = reg[pCode->code[iCode].F];
 
-				F  = pStack[--numStack];
-				T = pStack[--numStack];
-				Q  = pStack[--numStack];
-				break;
-			}
-			default:
-				assert(0);
-			} // end-switch
+			if (pCode->code[iCode].T & signatureCode_t::T_INVERT)
+				T ^= IBIT;
 
 			/*
 			 * Only arrive here when Q/T/F have been set 
@@ -2397,19 +2573,16 @@ struct groupTree_t {
 					assert(Ri == 0); // unknown how to handle this
 				}
 
-				freeMap(pStack);
-				freeMap(pMap);
 				return IBIT ^ (IBIT - 1); // return silently-ignore
 			}
 
 			if (T == F) {
 				// collapse
 
-				// Push onto stack
-				pStack[numStack++] = F ^ Ri;
-				pMap[nextNode++]   = F ^ Ri;
+				// component result
+				reg[signatureCode_t::REG_NODE + iCode] = F ^ Ri;
 
-			} else if (pattern[1]) {
+			} else if (iCode + 1 < pCode->numCode) {
 
 				// allocate storage for scope
 				groupLayer_t newLayer(*this, &layer);
@@ -2422,8 +2595,6 @@ struct groupTree_t {
 				 * if nothing was found then some loop was detected
 				 */
 				if (newLayer.gid == IBIT && newLayer.ucList == IBIT) {
-					freeMap(pStack);
-					freeMap(pMap);
 					return IBIT ^ (IBIT - 1); // return silently-ignore
 				}
 
@@ -2446,14 +2617,11 @@ struct groupTree_t {
 				 */
 				if (ret == (IBIT ^ (IBIT - 1))) {
 					// yes, silently ignore
-					freeMap(pStack);
-					freeMap(pMap);
 					return ret;
 				}
 
-				// Push onto stack
-				pStack[numStack++] = newLayer.gid ^ Ri;
-				pMap[nextNode++]   = newLayer.gid ^ Ri;
+				// component result
+				reg[signatureCode_t::REG_NODE + iCode] = newLayer.gid ^ Ri;
 
 				/*
 				 * @date 2022-01-12 13:21:33
@@ -2475,14 +2643,9 @@ struct groupTree_t {
 				 */
 
 			} else {
-				assert(numStack == 0);
-
 				// NOTE: top-level, use same depth/indent as caller
 				uint32_t ret = addBasicNode(layer, Q, Tu, Ti, F, depth);
 
-				freeMap(pStack);
-				freeMap(pMap);
-
 				if (pInvert) {
 					*pInvert = Ri;
 				} else {
@@ -2497,9 +2660,7 @@ struct groupTree_t {
 		 * This path is taken when the last node was a SID_SELF
 		 */
 
-		assert(numStack == 1); // only result on stack
-
-		uint32_t R = pStack[0]; // save before releasing
+		uint32_t R = reg[pCode->root];
 		
 		// normalization requested?
 		if (pInvert) {
@@ -2514,15 +2675,10 @@ struct groupTree_t {
 		// self-collapse
 		if (layer.gid == R) {
 			// yes
-			freeMap(pStack);
-			freeMap(pMap);
 			assert(0); // does this happen
 			return IBIT ^ (IBIT - 1); // return silently-ignore
 		}
 
-		freeMap(pStack);
-		freeMap(pMap);
-
 		// merge result into group under construction
 		addOldNode(layer, R);
 
@@ -2538,140 +2694,34 @@ struct groupTree_t {
 
 		assert(mid != 0);
 
-		member_t   *pMember          = db.members + mid;
-		unsigned   numPlaceholder    = db.signatures[pMember->sid].numPlaceholder;
-		const char *pMemberTransform = db.revTransformNames[pMember->tid];
+		member_t *pMember       = db.members + mid;
+		unsigned numPlaceholder = db.signatures[pMember->sid].numPlaceholder;
 
 		// group id must be latest
 		assert(layer.gid == IBIT || layer.gid == this->N[layer.gid].gid);
 
 		/*
-		 * init
+		 * @date 2022-03-13 21:44:09
+		 * Instantiate the cached compiled member instead of parsing its name.
+		 * Registers: zero, slots with member transform applied, followed by component results.
+		 * NOTE: copy, deeper calls may evict the cache entry
 		 */
+		const signatureCode_t code = *db.lookupMemberCode(mid);
+		const signatureCode_t *pCode = &code;
+		uint32_t              reg[signatureCode_t::REG_NODE + signatureCode_t::MAXCODE];
 
-		unsigned numStack = 0;
-		uint32_t nextNode = this->nstart;
-		uint32_t *pStack  = allocMap(); // evaluation stack
-		uint32_t *pMap    = allocMap(); // node id of intermediates
+		reg[0] = 0;
+		for (unsigned iSlot = 0; iSlot < numPlaceholder; iSlot++)
+			reg[1 + iSlot] = pSlots[iSlot];
 
-		/*
-		 * Load string
-		 */
-//		printf("M %u:%s\n", mid, pMember->name);
-		for (const char *pattern = pMember->name; *pattern; pattern++) {
-
-			uint32_t Q, T, F;
-
-			switch (*pattern) {
-			case '0': //
-				/*
-				 * Push zero
-				 */
-				assert (numStack < maxNodes);
-				pStack[numStack++] = 0;
-				continue; // for
-
-				// @formatter:off
-			case '1': case '2': case '3':
-			case '4': case '5': case '6':
-			case '7': case '8': case '9':
-				// @formatter:on
-			{
-				/*
-				 * Push back-reference
-				 */
-				uint32_t v = nextNode - (*pattern - '0');
-
-				assert (v >= this->nstart && v < nextNode);
-
-				assert (numStack < maxNodes);
-				pStack[numStack++] = pMap[v];
-				continue; // for
-			}
-
-				// @formatter:off
-			case 'a': case 'b': case 'c': case 'd':
-			case 'e': case 'f': case 'g': case 'h':
-			case 'i': case 'j': case 'k': case 'l':
-			case 'm': case 'n': case 'o': case 'p':
-			case 'q': case 'r': case 's': case 't':
-			case 'u': case 'v': case 'w': case 'x':
-			case 'y': case 'z':
-				// @formatter:on
-			{
-				/*
-				 * Push endpoint
-				 */
-				uint32_t v = (*pattern - 'a');
-
-				assert(v < numPlaceholder);
-
-				// apply member transform
-				v = (pMemberTransform[v] - 'a');
-
-				assert (numStack < maxNodes);
-				pStack[numStack++] = pSlots[v];
-				continue; // for
-
-			}
-
-			case '+': {
-				// OR (appreciated)
-				assert(numStack >= 2);
-
-				F  = pStack[--numStack];
-				T = IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '>': {
-				// GT (appreciated)
-				assert(numStack >= 2);
+		for (unsigned iCode = 0; iCode < pCode->numCode; iCode++) {
 
-				F  = 0;
-				T = pStack[--numStack] ^ IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '^': {
-				// XOR/NE (appreciated)
-				assert(numStack >= 2);
+			uint32_t Q = reg[pCode->code[iCode].Q];
+			uint32_t T = reg[pCode->code[iCode].T & ~signatureCode_t::T_INVERT];
+			uint32_t F = reg[pCode->code[iCode].F];
 
-				F  = pStack[--numStack];
-				T = F ^ IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '!': {
-				// QnTF (appreciated)
-				assert(numStack >= 3);
-
-				F  = pStack[--numStack];
-				T = pStack[--numStack] ^ IBIT;
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '&': {
-				// AND (depreciated)
-				assert(numStack >= 2);
-
-				F  = 0;
-				T = pStack[--numStack];
-				Q  = pStack[--numStack];
-				break;
-			}
-			case '?': {
-				// QTF (depreciated)
-				assert(numStack >= 3);
-
-				F  = pStack[--numStack];
-				T = pStack[--numStack];
-				Q  = pStack[--numStack];
-				break;
-			}
-			default:
-				assert(0);
-			} // end-switch
+			if (pCode->code[iCode].T & signatureCode_t::T_INVERT)
+				T ^= IBIT;
 
 			/*
 			 * Only arrive here when Q/T/F have been set 
@@ -2694,19 +2744,16 @@ struct groupTree_t {
 					assert(Ri == 0); // unknown how to handle this
 				}
 
-				freeMap(pStack);
-				freeMap(pMap);
 				return IBIT ^ (IBIT - 1); // return silently-ignore
 			}
 
 			if (Q == F) {
 				// collapse
 
-				// Push onto stack
-				pStack[numStack++] = F ^ Ri;
-				pMap[nextNode++]   = F ^ Ri;
+				// component result
+				reg[signatureCode_t::REG_NODE + iCode] = F ^ Ri;
 
-			} else if (pattern[1]) {
+			} else if (iCode + 1 < pCode->numCode) {
 
 				// allocate storage for scope
 				groupLayer_t newLayer(*this, &layer);
@@ -2719,8 +2766,6 @@ struct groupTree_t {
 				 * if nothing was found then some loop was detected
 				 */
 				if (newLayer.gid == IBIT && newLayer.ucList == IBIT) {
-					freeMap(pStack);
-					freeMap(pMap);
 					return IBIT ^ (IBIT - 1); // return silently-ignore
 				}
 
@@ -2743,14 +2788,11 @@ struct groupTree_t {
 				 */
 				if (ret == (IBIT ^ (IBIT - 1))) {
 					// yes, silently ignore
-					freeMap(pStack);
-					freeMap(pMap);
 					return ret;
 				}
 
-				// Push onto stack
-				pStack[numStack++] = newLayer.gid ^ Ri;
-				pMap[nextNode++]   = newLayer.gid ^ Ri;
+				// component result
+				reg[signatureCode_t::REG_NODE + iCode] = newLayer.gid ^ Ri;
 
 				/*
 				 * @date 2022-01-12 13:21:33
@@ -2772,14 +2814,9 @@ struct groupTree_t {
 				 */
 
 			} else {
-				assert(numStack == 0);
-
 				// NOTE: top-level, use same depth/indent as caller
 				uint32_t ret = addBasicNode(layer, Q, Tu, Ti, F, depth);
 
-				freeMap(pStack);
-				freeMap(pMap);
-
 				if (pInvert) {
 					*pInvert = Ri;
 				} else {
@@ -2794,9 +2831,7 @@ struct groupTree_t {
 		 * This path is taken when the last node was a SID_SELF
 		 */
 
-		assert(numStack == 1); // only result on stack
-
-		uint32_t R = pStack[0]; // save before releasing
+		uint32_t R = reg[pCode->root];
 
 		// normalization requested?
 		if (pInvert) {
@@ -2811,15 +2846,10 @@ struct groupTree_t {
 		// self-collapse
 		if (layer.gid == R) {
 			// yes
-			freeMap(pStack);
-			freeMap(pMap);
 			assert(0); // does this happen
 			return IBIT ^ (IBIT - 1); // return silently-ignore
 		}
 
-		freeMap(pStack);
-		freeMap(pMap);
-
 		// merge result into group under construction
 		addOldNode(layer, R);
 
@@ -3303,7 +3333,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		this->cntAddBasicNode++;
 
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
-			fprintf(stderr, "[%s] cntAddNormaliseNode=%lu cntAddBasicNode=%lu ncount=%u gcount=%u | cntOutdated=%lu cntRestart=%lu cntUpdateGroupCollapse=%lu cntUpdateGroupMerge=%lu cntApplySwapping=%lu cntApplyFolding=%lu cntMergeGroups=%lu\n", ctx.timeAsString(),
+			fprintf(stderr, "[%s] cntAddNormaliseNode=%lu cntAddBasicNode=%lu ncount=%u gcount=%u | cntOutdated=%lu cntRestart=%lu cntUpdateGroupCollapse=%lu cntUpdateGroupMerge=%lu cntApplySwapping=%lu cntApplyFolding=%lu cntMergeGroups=%lu | cntValidate=%lu timeValidate=%.3f\n", ctx.timeAsString(),
 				this->cntAddNormaliseNode,
 				this->cntAddBasicNode,
 				this->ncount,
@@ -3315,12 +3345,15 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 				this->cntUpdateGroupMerge,
 				this->cntApplySwapping,
 				this->cntApplyFolding,
-				this->cntMergeGroups
+				this->cntMergeGroups,
+
+				this->cntValidateRun,
+				this->timeValidate
 			);
 			ctx.tick = 0;
 
 			if (depth == 0)
-				validateTree(__LINE__);
+				tickValidate(__LINE__);
 		}
 
 		assert(!(Q & IBIT));                       // Q not inverted
@@ -4567,7 +4600,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			groupNode_t *pNew = this->N + nid;
 
 			pNew->gid   = layer.gid;
-			pNew->oldId = pNode->oldId ? pNode->oldId : iNode;
+			this->oldIds[nid] = this->oldIds[iNode] ? this->oldIds[iNode] : iNode;
 
 			// add node to index
 			this->nodeIndex[nix]        = nid;
@@ -4591,7 +4624,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			if (ctx.opt_debug & ctx.DEBUGMASK_GROUPNODE) {
 				printf("gid=%u\tnid=%u\told=%u\t%u:%s/[%u %u %u %u %u %u %u %u %u] siz=%u wgt=%f\n",
 				       layer.gid, nid,
-				       pNew->oldId,
+				       this->oldIds[nid],
 				       newSid, db.signatures[newSid].name,
 				       newSlots[0], newSlots[1], newSlots[2], newSlots[3], newSlots[4], newSlots[5], newSlots[6], newSlots[7], newSlots[8],
 				       db.signatures[newSid].size, pNew->weight);
@@ -4628,7 +4661,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			assert(newGid == this->N[newGid].slots[0]);
 
 			this->N[newGid].gid   = newGid;
-			this->N[newGid].oldId = this->N[layer.gid].oldId ? this->N[layer.gid].oldId : layer.gid;
+			this->oldIds[newGid] = this->oldIds[layer.gid] ? this->oldIds[layer.gid] : layer.gid;
 
 			/*
 			 * Walk and update the list
@@ -4970,14 +5003,14 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 
 	void __attribute__((used)) listHistory(uint32_t iNode) {
 
-		uint32_t oldId = this->N[iNode].oldId;
+		uint32_t oldId = this->oldIds[iNode];
 		if (!oldId)
 			return;
 
 		for (uint32_t iNode = oldId; iNode < this->ncount; iNode++) {
 			groupNode_t *pNode = this->N + iNode;
 
-			if (pNode->oldId == oldId) {
+			if (this->oldIds[iNode] == oldId) {
 				showLine(pNode->gid, iNode, NULL, NULL, NULL);
 				printf("\n");
 			}
@@ -5178,7 +5211,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			uint32_t thisVersion = ++slotVersionNr;
 			if (thisVersion == 0) {
 				// version overflow, clear
-				memset(slotVersion, 0, this->maxNodes * sizeof(*slotVersion));
+				context_t::myClearLazy(slotVersion, this->maxNodes * sizeof(*slotVersion));
 
 				thisVersion = ++slotVersionNr;
 			}
@@ -5248,7 +5281,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			printf("<GROUP=%u>", iGroup);
 
 		printf("%u(%u)\t%u(%u)\t%u:%s/[",
-		       pNode->gid, this->N[pNode->gid].oldId, iNode, pNode->oldId,
+		       pNode->gid, this->oldIds[pNode->gid], iNode, this->oldIds[iNode],
 		       pNode->sid, pSignature->name);
 
 		char delimiter = 0;
@@ -5286,12 +5319,108 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			printf("<MULTI>");
 	}
 
+	/*
+	 * @date 2022-03-13 21:12:35
+	 *
+	 * Collect background validation.
+	 * Its failure means the snapshot was invalid, handle as if it was a foreground validation.
+	 * The child counted its validation in its own copy of `cntValidate`, count success here for `<LASTGOOD=>`.
+	 */
+	void reapValidate(bool wait) {
+		int status;
+
+		pid_t pid = waitpid(validatePid, &status, wait ? 0 : WNOHANG);
+		if (pid == 0)
+			return; // still running
+		if (pid < 0)
+			ctx.fatal("\n{\"error\":\"waitpid() failed\",\"where\":\"%s:%s:%d\",\"errno\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		validatePid = 0;
+
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			ctx.fatal("\n{\"error\":\"background validation failed\",\"where\":\"%s:%s:%d\",\"status\":%d}\n",
+				  __FUNCTION__, __FILE__, __LINE__, status);
+
+		this->cntValidate++;
+	}
+
+	/*
+	 * @date 2022-03-13 21:08:51
+	 *
+	 * Progress tick triggered validation, according to `validate` policy.
+	 * Time spent in the calling process is accumulated in `timeValidate`.
+	 */
+	void tickValidate(unsigned lineNr) {
+		if (validate == VALIDATE_OFF)
+			return;
+
+		struct timespec t0, t1;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+
+		if (validate == VALIDATE_SAMPLE) {
+			// next region, wrap around when exhausted
+			if (validatePos < this->nstart || validatePos >= this->ncount)
+				validatePos = this->nstart;
+
+			uint32_t iHi = this->ncount;
+			if (iHi - validatePos > DEFAULT_VALIDATESAMPLE)
+				iHi = validatePos + DEFAULT_VALIDATESAMPLE;
+
+			validateTree(lineNr, validatePos, iHi);
+			validatePos = iHi;
+			cntValidateRun++;
+
+		} else if (++validateTicks >= validateInterval) {
+			validateTicks = 0;
+
+			if (validate == VALIDATE_FULL) {
+				validateTree(lineNr);
+				cntValidateRun++;
+			} else {
+				// skip when previous snapshot still being validated
+				if (validatePid)
+					reapValidate(false);
+
+				if (!validatePid) {
+					// child validates a copy-on-write snapshot
+					fflush(stdout);
+					fflush(stderr);
+
+					validatePid = fork();
+					if (validatePid < 0)
+						ctx.fatal("\n{\"error\":\"fork() failed\",\"where\":\"%s:%s:%d\",\"errno\":\"%m\"}\n",
+							  __FUNCTION__, __FILE__, __LINE__);
+
+					if (validatePid == 0) {
+						validateTree(lineNr);
+						fflush(stdout);
+						_exit(0);
+					}
+					cntValidateRun++;
+				}
+			}
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		timeValidate += (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+	}
+
 	/*
 	 * @date 2021-11-11 16:44:08
 	 * 
 	 * For debugging
+	 *
+	 * @date 2022-03-13 21:16:20
+	 * Optional region `[iLo,iHi)` restricts the group and orphan checks, and skips the tree-wide forward loop detection.
 	 */
-	void validateTree(unsigned lineNr) {
+	void validateTree(unsigned lineNr, uint32_t iLo = 0, uint32_t iHi = 0) {
+		if (iHi == 0) {
+			iLo = this->nstart;
+			iHi = this->ncount;
+		}
+		bool isRegion = (iLo != this->nstart || iHi != this->ncount);
+
 		uint32_t        *pSidCount   = allocMap();
 		versionMemory_t *pSidVersion = allocVersion();
 		versionMemory_t *pNodeFound  = allocVersion();
@@ -5304,7 +5433,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 
 		pNodeFound->nextVersion(); // bump version
 
-		for (uint32_t iGroup = this->nstart; iGroup < this->ncount; iGroup++) {
+		for (uint32_t iGroup = iLo; iGroup < iHi; iGroup++) {
 			// find group headers
 			if (this->N[iGroup].gid != iGroup)
 				continue;
@@ -5407,13 +5536,15 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		 * Check orphans
 		 */
 
-		for (uint32_t iNode = this->nstart; iNode < this->ncount; iNode++) {
+		for (uint32_t iNode = iLo; iNode < iHi; iNode++) {
 			const groupNode_t *pNode = this->N + iNode;
 
 			if (pNode->gid == IBIT)
 				continue; // under construction
 			if (pNodeFound->mem[iNode] == pNodeFound->version)
 				continue; // already processed
+			if (isRegion && (pNode->gid < iLo || pNode->gid >= iHi))
+				continue; // group outside region
 			if (this->N[iNode].next == iNode)
 				continue; // orphans live in solitude
 
@@ -5529,7 +5660,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		 *   creating the (rare) possibility that a path exists that does have a forward reference. 
 		 */
 
-		if (true) {
+		if (!isRegion) {
 			versionMemory_t *pVersion   = pSidVersion; // NOTE: reuse storage
 			uint32_t        thisVersion = pVersion->nextVersion();
 
@@ -5638,7 +5769,8 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 	 *
 	 * NOTE: `std::string` usage exception because this is NOT speed critical code AND strings can become gigantically large
 	 */
-	static void encodePrefix(std::string &name, unsigned value) {
+	template<class T>
+	static void encodePrefix(T &name, unsigned value) {
 		// NOTE: 0x7fffffff = `GYTISXx`
 
 		// creating is right-to-left. Storage to reverse
@@ -5659,6 +5791,25 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		}
 	}
 
+	/*
+	 * @date 2022-03-14 00:00:20
+	 *
+	 * Inverse of `encodePrefix()`.
+	 * Consume the upper-case prefix starting at `pattern` and leave `pattern` at the first character following it.
+	 */
+	static inline uint32_t decodePrefix(const char *&pattern) {
+		uint32_t v = 0;
+		unsigned c;
+
+		// unsigned compare avoids the locale lookups of `isupper()`
+		while ((c = (unsigned char) *pattern - 'A') < 26) {
+			v = v * 26 + c;
+			pattern++;
+		}
+
+		return v;
+	}
+
 	/*
 	 * @date 2021-12-12 12:24:22
 	 * 
@@ -5668,12 +5819,37 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 	 * NOTE: id/references are as-is and not updated to latest
 	 */
 	std::string saveString(uint32_t id, std::string *pTransform = NULL, bool allRoots = false) {
+		std::string name;
+
+		emitString(name, id, pTransform, allRoots);
+
+		return name;
+	}
+
+	/*
+	 * @date 2022-03-14 00:12:14
+	 *
+	 * Export as `saveString()`, streaming to `outf` through a bounded buffer.
+	 */
+	void saveString(FILE *outf, uint32_t id, std::string *pTransform = NULL, bool allRoots = false) {
+		streamWriter_t writer(ctx, outf);
+
+		emitString(writer, id, pTransform, allRoots);
+		writer.flush();
+	}
+
+	/*
+	 * @date 2022-03-14 00:12:30
+	 *
+	 * Shared by both `saveString()` variants, `name` needs a `+= char` operator.
+	 */
+	template<class T>
+	void emitString(T &name, uint32_t id, std::string *pTransform, bool allRoots) {
 
 		uint32_t        nextPlaceholder  = this->kstart;        // next placeholder for `pTransform`
 		uint32_t        nextExportNodeId = this->nstart;        // next nodeId for exported name
 		uint32_t        *pMap            = allocMap();          // maps internal to exported node id 
 		versionMemory_t *pVersion        = allocVersion();      // version data for `pMap`.
-		std::string     name;
 
 		// bump version number
 		pVersion->nextVersion();
@@ -5704,333 +5880,88 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 
 		freeMap(pMap);
 		freeVersion(pVersion);
-
-		// return name
-		return name;
 	}
 
 	/*
 	 * @date 2022-02-13 15:56:45
 	 * Evaluate a node
+	 *
+	 * @date 2022-03-13 18:52:16
+	 * Uses the compiled signature, `db.compileSignatures()`.
+	 * Register `0` is `pFeet[0]`, like the `'0'` of the signature name.
 	 */
 	footprint_t evalNode(uint32_t nid, footprint_t *pFeet) {
 		assert(nid);
 
-		uint32_t    numStack = 0;
-		uint32_t    nextNode = this->nstart;
-		footprint_t stack[tinyTree_t::TINYTREE_MAXSTACK]; // evaluator stack
-		footprint_t backref[tinyTree_t::TINYTREE_MAXNODES]; // back references
-
-		groupNode_t *pNode = this->N + nid;
-
-		/*
-		 * Load string
-		 */
-		for (const char *pattern = db.signatures[this->N[nid].sid].name; *pattern; pattern++) {
-
-			const footprint_t *pQ, *pTu, *pF;
-
-			switch (*pattern) {
-			case '0': //
-				/*
-				 * Push zero
-				 */
-				stack[numStack++] = pFeet[0];
-				continue; // for
+		const groupNode_t     *pNode = this->N + nid;
+		assert(pNode->sid < db.numSignatureCode);
+		const signatureCode_t *pCode = db.signatureCodes + pNode->sid;
 
-				// @formatter:off
-			case '1': case '2': case '3':
-			case '4': case '5': case '6':
-			case '7': case '8': case '9':
-				// @formatter:on
-			{
-				/*
-				 * Push back-reference
-				 */
-				uint32_t v = nextNode - (*pattern - '0');
+		footprint_t       result[signatureCode_t::MAXCODE]; // instruction results
+		const footprint_t *reg[signatureCode_t::REG_NODE + signatureCode_t::MAXCODE]; // registers
 
-				assert (v >= this->nstart && v < nextNode);
-				assert (numStack <= tinyTree_t::TINYTREE_MAXSTACK);
+		reg[0] = pFeet;
+		for (unsigned iSlot = 0; iSlot < MAXSLOTS; iSlot++)
+			reg[1 + iSlot] = pFeet + pNode->slots[iSlot];
 
-				stack[numStack++] = backref[v - this->nstart];
-				continue; // for
-			}
-
-				// @formatter:off
-			case 'a': case 'b': case 'c': case 'd':
-			case 'e': case 'f': case 'g': case 'h':
-			case 'i': case 'j': case 'k': case 'l':
-			case 'm': case 'n': case 'o': case 'p':
-			case 'q': case 'r': case 's': case 't':
-			case 'u': case 'v': case 'w': case 'x':
-			case 'y': case 'z':
-				// @formatter:on
-			{
-				/*
-				 * Push endpoint
-				 */
-				uint32_t v = *pattern - 'a';
-				assert (v <= db.signatures[pNode->sid].numPlaceholder);
-				
-				v = pNode->slots[v];
-
-				assert (v >= this->kstart && v < this->ncount);
-				assert (numStack <= tinyTree_t::TINYTREE_MAXSTACK);
-
-				stack[numStack++] = pFeet[v];
-				continue; // for
-			}
-
-			case '+': {
-				// OR (appreciated)
-				assert (numStack >= 2);
-
-				pF = &stack[--numStack];
-				pQ = &stack[--numStack];
-
-				for (unsigned i = 0; i < footprint_t::QUADPERFOOTPRINT; i++)
-					stack[numStack].bits[i] = pQ->bits[i] | pF->bits[i];
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '>': {
-				// GT (appreciated)
-				assert (numStack >= 2);
-
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
-
-				for (unsigned i = 0; i < footprint_t::QUADPERFOOTPRINT; i++)
-					stack[numStack].bits[i] = pQ->bits[i] & ~pTu->bits[i];
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '^': {
-				// XOR/NE (appreciated)
-				assert (numStack >= 2);
-
-				pF = &stack[--numStack];
-				pQ = &stack[--numStack];
-
-				for (unsigned i = 0; i < footprint_t::QUADPERFOOTPRINT; i++)
-					stack[numStack].bits[i] = pQ->bits[i] ^ pF->bits[i];
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '!': {
-				// QnTF (appreciated)
-				assert (numStack >= 3);
-
-				pF  = &stack[--numStack];
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
-
-				for (unsigned i = 0; i < footprint_t::QUADPERFOOTPRINT; i++)
-					stack[numStack].bits[i] = (pQ->bits[i] & ~pTu->bits[i]) | (~pQ->bits[i] & pF->bits[i]);
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '&': {
-				// AND (depreciated)
-				assert (numStack >= 2);
-
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
+		for (unsigned iCode = 0; iCode < pCode->numCode; iCode++) {
+			const footprint_t *pQ = reg[pCode->code[iCode].Q];
+			const footprint_t *pT = reg[pCode->code[iCode].T & ~signatureCode_t::T_INVERT];
+			const footprint_t *pF = reg[pCode->code[iCode].F];
+			footprint_t       *pR = result + iCode;
 
+			if (pCode->code[iCode].T & signatureCode_t::T_INVERT) {
 				for (unsigned i = 0; i < footprint_t::QUADPERFOOTPRINT; i++)
-					stack[numStack].bits[i] = pQ->bits[i] & pTu->bits[i];
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '?': {
-				// QTF (depreciated)
-				assert (numStack >= 3);
-
-				pF  = &stack[--numStack];
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
-
+					pR->bits[i] = (pQ->bits[i] & ~pT->bits[i]) | (~pQ->bits[i] & pF->bits[i]);
+			} else {
 				for (unsigned i = 0; i < footprint_t::QUADPERFOOTPRINT; i++)
-					stack[numStack].bits[i] = (pQ->bits[i] & pTu->bits[i]) | (~pQ->bits[i] & pF->bits[i]);
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
+					pR->bits[i] = (pQ->bits[i] & pT->bits[i]) | (~pQ->bits[i] & pF->bits[i]);
 			}
 
-			default:
-				assert(!"bad token");
-			}
-
-			assert(numStack <= tinyTree_t::TINYTREE_MAXSTACK);
-			assert(nextNode - this->nstart <= tinyTree_t::TINYTREE_MAXNODES);
+			reg[signatureCode_t::REG_NODE + iCode] = pR;
 		}
 
-		assert(numStack == 1);
-		return stack[0];
+		return *reg[pCode->root];
 	}
 
 	/*
 	 * @date 2022-02-13 15:56:45
 	 * Evaluate a node
+	 *
+	 * @date 2022-03-13 18:52:16
+	 * Uses the compiled signature, `db.compileSignatures()`.
+	 * Register `0` is `pFeet[0]`, like the `'0'` of the signature name.
+	 *
+	 * @date 2022-03-14 00:57:09
+	 * Word type is a template argument, each bit is an independent lane.
+	 * `uint64_t` evaluates 64 bit-sliced test vectors in a single pass.
 	 */
-	uint32_t evalNode(uint32_t nid, uint32_t *pFeet) {
+	template<class W>
+	W evalNode(uint32_t nid, W *pFeet) {
 		assert(nid);
 
-		uint32_t numStack = 0;
-		uint32_t nextNode = this->nstart;
-		uint32_t stack[tinyTree_t::TINYTREE_MAXSTACK]; // evaluator stack
-		uint32_t backref[tinyTree_t::TINYTREE_MAXNODES]; // back references
-
-		groupNode_t *pNode = this->N + nid;
-
-		/*
-		 * Load string
-		 */
-		for (const char *pattern = db.signatures[this->N[nid].sid].name; *pattern; pattern++) {
-
-			const uint32_t *pQ, *pTu, *pF;
-
-			switch (*pattern) {
-			case '0': //
-				/*
-				 * Push zero
-				 */
-				stack[numStack++] = pFeet[0];
-				continue; // for
-
-				// @formatter:off
-			case '1': case '2': case '3':
-			case '4': case '5': case '6':
-			case '7': case '8': case '9':
-				// @formatter:on
-			{
-				/*
-				 * Push back-reference
-				 */
-				uint32_t v = nextNode - (*pattern - '0');
-
-				assert (v >= this->nstart && v < nextNode);
-				assert (numStack <= tinyTree_t::TINYTREE_MAXSTACK);
-
-				stack[numStack++] = backref[v - this->nstart];
-				continue; // for
-			}
-
-				// @formatter:off
-			case 'a': case 'b': case 'c': case 'd':
-			case 'e': case 'f': case 'g': case 'h':
-			case 'i': case 'j': case 'k': case 'l':
-			case 'm': case 'n': case 'o': case 'p':
-			case 'q': case 'r': case 's': case 't':
-			case 'u': case 'v': case 'w': case 'x':
-			case 'y': case 'z':
-				// @formatter:on
-			{
-				/*
-				 * Push endpoint
-				 */
-				uint32_t v = *pattern - 'a';
-				assert (v <= db.signatures[pNode->sid].numPlaceholder);
-				
-				v = pNode->slots[v];
-
-				assert (v >= this->kstart && v < this->ncount);
-				assert (numStack <= tinyTree_t::TINYTREE_MAXSTACK);
-
-				stack[numStack++] = pFeet[v];
-				continue; // for
-			}
-
-			case '+': {
-				// OR (appreciated)
-				assert (numStack >= 2);
+		const groupNode_t     *pNode = this->N + nid;
+		assert(pNode->sid < db.numSignatureCode);
+		const signatureCode_t *pCode = db.signatureCodes + pNode->sid;
 
-				pF = &stack[--numStack];
-				pQ = &stack[--numStack];
+		W reg[signatureCode_t::REG_NODE + signatureCode_t::MAXCODE]; // registers
 
-				stack[numStack] = *pQ | *pF;
+		reg[0] = pFeet[0];
+		for (unsigned iSlot = 0; iSlot < MAXSLOTS; iSlot++)
+			reg[1 + iSlot] = pFeet[pNode->slots[iSlot]];
 
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '>': {
-				// GT (appreciated)
-				assert (numStack >= 2);
-
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
-
-				stack[numStack] = *pQ & ~*pTu;
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '^': {
-				// XOR/NE (appreciated)
-				assert (numStack >= 2);
-
-				pF = &stack[--numStack];
-				pQ = &stack[--numStack];
-
-				stack[numStack] = *pQ ^ *pF;
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '!': {
-				// QnTF (appreciated)
-				assert (numStack >= 3);
-
-				pF  = &stack[--numStack];
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
-
-				stack[numStack] = (*pQ & ~*pTu) | (~*pQ & *pF);
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '&': {
-				// AND (depreciated)
-				assert (numStack >= 2);
+		for (unsigned iCode = 0; iCode < pCode->numCode; iCode++) {
+			W Q = reg[pCode->code[iCode].Q];
+			W T = reg[pCode->code[iCode].T & ~signatureCode_t::T_INVERT];
+			W F = reg[pCode->code[iCode].F];
 
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
+			if (pCode->code[iCode].T & signatureCode_t::T_INVERT)
+				T = ~T;
 
-				stack[numStack] = *pQ & *pTu;
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-			case '?': {
-				// QTF (depreciated)
-				assert (numStack >= 3);
-
-				pF  = &stack[--numStack];
-				pTu = &stack[--numStack];
-				pQ  = &stack[--numStack];
-
-				stack[numStack] = (*pQ & *pTu) | (~*pQ & *pF);
-
-				backref[nextNode++ - this->nstart] = stack[numStack++];
-				break;
-			}
-
-			default:
-				assert(!"bad token");
-			}
-
-			assert(numStack <= tinyTree_t::TINYTREE_MAXSTACK);
-			assert(nextNode - this->nstart <= tinyTree_t::TINYTREE_MAXNODES);
+			reg[signatureCode_t::REG_NODE + iCode] = (Q & T) | (~Q & F);
 		}
 
-		assert(numStack == 1);
-		return stack[0];
+		return reg[pCode->root];
 	}
 
 	/**
@@ -6046,7 +5977,8 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 	 * @param {uint32_t*} pTransform       - Endpoints for transform placeholders [DISABLED WHEN NULL]
 	 * @param {uint32_t&} nextPlaceholder  - Next `pTransform` placeholder to be assigned
 	 */
-	void saveStringNode(uint32_t nid, uint32_t &nextExportNodeId, std::string &exportName, versionMemory_t *pVersion, uint32_t *pMap, std::string *pTransform, uint32_t &nextPlaceholder) {
+	template<class T>
+	void saveStringNode(uint32_t nid, uint32_t &nextExportNodeId, T &exportName, versionMemory_t *pVersion, uint32_t *pMap, std::string *pTransform, uint32_t &nextPlaceholder) {
 
 		// caller did `nextVersion()`, get (that) current version 
 		uint32_t thisVersion = pVersion->version;
@@ -6463,16 +6395,33 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		if (pSkin && *pSkin)
 			transformList = decodeTransform(ctx, this->kstart, this->nstart, pSkin);
 
+		// scratch for stack and node map, sized to the string
+		size_t   nameLen   = strlen(pName);
+		uint32_t *pScratch = (uint32_t *) ctx.myAlloc("groupTree_t::pScratch", 2 * (nameLen + 1), sizeof *pScratch);
+
+		uint32_t ret = parseStringSafe(pName, transformList, pRoots ? pRoots : pScratch, pScratch + nameLen + 1, pRoots != NULL);
+
+		ctx.myFree("groupTree_t::pScratch", pScratch);
+		if (transformList)
+			ctx.myFree("groupTree_t::transformList", transformList);
+
+		return ret;
+	}
+
+	/*
+	 * @date 2022-03-14 00:01:10
+	 *
+	 * Parser behind `loadStringSafe()`.
+	 * `pStack` holds at least one entry per token, `pMap` is indexed by node relative to `nstart`.
+	 */
+	uint32_t parseStringSafe(const char *pName, const uint32_t *transformList, uint32_t *pStack, uint32_t *pMap, bool multiRoot) {
+
 		/*
 		 * init
-		 * Formerly, `pStack` was separately allocated. Now it goes directly into the roots
-		 * Now, 
 		 */
 
 		uint32_t numStack = 0;
 		uint32_t nextNode = this->nstart;
-		uint32_t *pStack  = pRoots ? pRoots : allocMap();
-		uint32_t *pMap    = allocMap();
 		uint32_t nid;
 
 		/*
@@ -6506,7 +6455,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 				if (numStack >= this->maxNodes)
 					ctx.fatal("[stack overflow]\n");
 
-				pStack[numStack++] = pMap[v];
+				pStack[numStack++] = pMap[v - this->nstart];
 				continue; // for
 			}
 
@@ -6550,9 +6499,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 				/*
 				 * Prefix
 				 */
-				uint32_t v = 0;
-				while (isupper(*pattern))
-					v = v * 26 + *pattern++ - 'A';
+				uint32_t v = decodePrefix(pattern);
 
 				if (isdigit(*pattern)) {
 					/*
@@ -6565,7 +6512,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 					if (numStack >= this->maxNodes)
 						ctx.fatal("[stack overflow]\n");
 
-					pStack[numStack++] = pMap[v];
+					pStack[numStack++] = pMap[v - this->nstart];
 				} else if (islower(*pattern)) {
 					/*
 					 * prefixed endpoint
@@ -6702,7 +6649,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 
 			// remember
 			pStack[numStack++] = nid;
-			pMap[nextNode++]   = nid;
+			pMap[nextNode++ - this->nstart] = nid;
 
 			if (numStack > this->maxNodes)
 				ctx.fatal("[stack overflow]\n");
@@ -6710,7 +6657,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 
 		uint32_t ret;
 
-		if (pRoots) {
+		if (multiRoot) {
 			// loaded multi-rooted tree
 			ret = numStack;
 
@@ -6729,13 +6676,6 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			ret = pStack[numStack - 1];
 		}
 
-
-		if (pRoots == NULL)
-			freeMap(pStack);
-		freeMap(pMap);
-		if (transformList)
-			ctx.myFree("groupTree_t::transformList", transformList);
-
 		return ret;
 	}
 
@@ -6825,7 +6765,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		}
 
 		fileHeader = (groupTreeHeader_t *) rawData;
-		if (fileHeader->magic != GROUPTREE_MAGIC)
+		if (fileHeader->magic != GROUPTREE_MAGIC && fileHeader->magic != GROUPTREE_MAGIC_V1)
 			ctx.fatal("baseTree version mismatch. Expected %08x, Encountered %08x\n", GROUPTREE_MAGIC, fileHeader->magic);
 		if (fileHeader->offEnd != (uint64_t) stbuf.st_size)
 			ctx.fatal("baseTree size mismatch. Expected %lu, Encountered %lu\n", fileHeader->offEnd, (uint64_t) stbuf.st_size);
@@ -6850,6 +6790,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 
 		// primary
 		N             = (groupNode_t *) (rawData + fileHeader->offNodes);
+		oldIds        = (uint32_t *) ctx.myAlloc("groupTree_t::oldIds", maxNodes, sizeof(*oldIds));
 		roots         = (uint32_t *) (rawData + fileHeader->offRoots);
 		history       = (uint32_t *) (rawData + fileHeader->offHistory);
 		// pools
@@ -6859,6 +6800,7 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		slotMap       = allocMap();
 		slotVersion   = allocMap(); // allocate as node-id map because of local version numbering
 		slotVersionNr = 1;
+		qtVersion     = 0;
 
 		// make all `entryNames`+`rootNames` indices valid
 		entryNames.resize(nstart - kstart);
@@ -6883,6 +6825,30 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 			assert(*pData == 0);
 		}
 
+		/*
+		 * @date 2022-03-13 20:22:07
+		 * Convert nodes of previous layout
+		 */
+		if (fileHeader->magic == GROUPTREE_MAGIC_V1) {
+			const groupNodeV1_t *pOld = (const groupNodeV1_t *) (rawData + fileHeader->offNodes);
+
+			N = (groupNode_t *) ctx.myAlloc("groupTree_t::N", maxNodes, sizeof(*N));
+			allocFlags |= ALLOCMASK_NODES;
+
+			for (uint32_t iNode = 0; iNode < ncount; iNode++) {
+				groupNode_t *pNode = N + iNode;
+
+				pNode->gid      = pOld[iNode].gid;
+				pNode->prev     = pOld[iNode].prev;
+				pNode->next     = pOld[iNode].next;
+				pNode->hiSlotId = pOld[iNode].hiSlotId;
+				pNode->weight   = pOld[iNode].weight;
+				pNode->sid      = pOld[iNode].sid;
+				memcpy(pNode->slots, pOld[iNode].slots, sizeof(pNode->slots));
+				oldIds[iNode] = pOld[iNode].oldId;
+			}
+		}
+
 		/*
 		 * @date 2022-01-11 15:53:49
 		 * Tree is read-only, and has no node index
@@ -6972,12 +6938,14 @@ else							/* 0  0  0  -> 0      -> 0  0  0  0  */  return Q=T=F=0,0;
 		fpos += 1;
 
 		/*
-		 * Align
+		 * Align to cache line
 		 */
-		fillLen = 16 - (fpos & 15);
-		if (fillLen < 16) {
-			fwrite(zero16, fillLen, 1, outf);
-			fpos += fillLen;
+		fillLen = 64 - (fpos & 63);
+		while (fillLen < 64 && fillLen > 0) {
+			size_t len = fillLen < 16 ? fillLen : 16;
+			fwrite(zero16, len, 1, outf);
+			fpos += len;
+			fillLen -= len;
 		}
 
 		/*
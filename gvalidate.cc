@@ -67,6 +67,9 @@ void sigalrmHandler(int __attribute__ ((unused)) sig) {
  */
 struct bvalidateContext_t {
 
+	/// @constant {number} - Number of tests evaluated simultaneously, one per bit of `uint64_t`
+	enum { NUMLANES = 64 };
+
 	/// @var {string} name of database
 	const char *opt_databaseName;
 	/// @var {number} header flags
@@ -170,7 +173,7 @@ struct bvalidateContext_t {
 
 		std::vector<std::string>        testNames;   // The names of the entries
 		std::map<std::string, unsigned> testLookup;  // Name lookup	
-		std::vector<uint32_t>           testData;    // Test values
+		std::vector<uint64_t>           testData;    // Test values, bit-sliced. One lane per test
 		std::vector<uint32_t>           entryMap;    // How tree entrypoints map onto test data
 		std::vector<uint32_t>           rootMap;     // How tree roots map onto test data
 
@@ -259,145 +262,234 @@ struct bvalidateContext_t {
 			json_delete(jList);
 		}
 
-		uint32_t *pEval = tree.allocMap(); // evaluation stack
-
-		// convert ascii to hex and inject at the appropriate location
-		for (unsigned iTest = 0; iTest < gNumTests; iTest++) {
-			/*
-			 * Load/decode the test 
-			 */
-
-			// extract test element
-			json_t     *jTest    = json_array_get(jTests, iTest);
-			const char *strEntry = json_string_value(json_array_get(jTest, 0));
-			const char *strRoots = json_string_value(json_array_get(jTest, 1));
-
-			// simple validation
-			if (!strEntry || !strRoots) {
-				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("Incomplete test entry"));
-				json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-				json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-			}
+		/*
+		 * @date 2022-03-13 23:07:31
+		 *
+		 * Validate tree structure.
+		 * Node references do not depend on test data and are checked once instead of per test.
+		 * Groups are evaluated in order, anything not an entrypoint or preceding group header is undefined.
+		 */
+		uint32_t *pDefined = tree.allocMap();
 
-			/*
-			 * decode entrypoint/root data
-			 */
-			unsigned iBit   = 0;
-			testData.resize(testNames.size());
-
-			// convert
-			for (unsigned iPos = 0; iPos < strlen(strEntry); /* increment in loop */ ) {
-				// skip spaces
-				if (isspace(strEntry[iPos])) {
-					iPos++;
-					continue;
-				}
+		for (uint32_t iNode = 0; iNode < tree.ncount; iNode++)
+			pDefined[iNode] = (iNode == 0 || (iNode >= tree.kstart && iNode < tree.nstart)) ? 1 : 0;
 
-				unsigned byte = 0;
+		for (uint32_t iGroup = tree.nstart; iGroup < tree.ncount; iGroup++) {
+			if (tree.N[iGroup].gid != iGroup)
+				continue; // not a group header
 
-				for (int iNibble = 0; iNibble < 2; iNibble++) {
-					char ch = strEntry[iPos++]; // loop decrement happens here
+			for (uint32_t iNode = tree.N[iGroup].next; iNode != iGroup; iNode = tree.N[iNode].next) {
+				groupNode_t *pNode = tree.N + iNode;
 
-					byte *= 16;
+				for (unsigned iSlot = 0; iSlot < pStore->signatures[pNode->sid].numPlaceholder; iSlot++) {
+					uint32_t id = pNode->slots[iSlot];
 
-					if (ch >= '0' && ch <= '9')
-						byte += ch - '0';
-					else if (ch >= 'A' && ch <= 'F')
-						byte += ch - 'A' + 10;
-					else if (ch >= 'a' && ch <= 'f')
-						byte += ch - 'a' + 10;
-					else {
+					// test range
+					if (id == 0 || id >= tree.ncount) {
 						json_t *jError = json_object();
-						json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad entry data in test entry"));
-						json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-						json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-						json_object_set_new_nocheck(jError, "key-data", json_string_nocheck(strEntry));
+						json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node references out-of-range"));
+						json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+						json_object_set_new_nocheck(jError, "gid", json_integer(iGroup));
+						json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
+						json_object_set_new_nocheck(jError, "slot", json_integer(iSlot));
+						json_object_set_new_nocheck(jError, "id", json_integer(id));
 						ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 					}
-				}
 
-				for (unsigned k = 0; k < 8; k++) {
-					if (iBit < jsonTree.nstart - jsonTree.kstart)
-						testData[iBit++] = (byte & (1 << k)) ? ~0U : 0U;
+					// test for undefined
+					if (!pDefined[id]) {
+						json_t *jError = json_object();
+						json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node values out-of-range"));
+						json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+						json_object_set_new_nocheck(jError, "gid", json_integer(iGroup));
+						json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
+						json_object_set_new_nocheck(jError, "slot", json_integer(iSlot));
+						json_object_set_new_nocheck(jError, "id", json_integer(id));
+						ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+					}
 				}
 			}
 
-			if (iBit < jsonTree.nstart - jsonTree.kstart) {
+			pDefined[iGroup] = 1;
+		}
+
+		for (unsigned iRoot = 0; iRoot < tree.numRoots; iRoot++) {
+			uint32_t R = tree.roots[iRoot] & ~IBIT;
+
+			if (R >= tree.ncount || !pDefined[R]) {
 				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("entry data too short in test entry"));
-				json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-				json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-				json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.nstart - jsonTree.kstart));
-				json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("Root loads undefined"));
+				json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+				json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
+				json_object_set_new_nocheck(jError, "nid", json_integer(R));
 				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 			}
+		}
+
+		tree.freeMap(pDefined);
+
+		/*
+		 * @date 2022-03-13 23:04:45
+		 *
+		 * Tests are evaluated bit-sliced, `NUMLANES` at a time.
+		 * Bit `iLane` of every `pEval[]`/`testData[]` word belongs to test `iBatch+iLane`.
+		 * The tree is walked once per batch instead of once per test.
+		 */
+		uint64_t *pEval = (uint64_t *) ctx.myAlloc("bvalidateContext_t::pEval", tree.ncount, sizeof(*pEval)); // evaluation stack
 
-			// convert
-			for (unsigned iPos = 0; iPos < strlen(strRoots); /* increment in loop */ ) {
-				// skip spaces
-				if (isspace(strRoots[iPos])) {
-					iPos++;
-					continue;
+		for (unsigned iBatch = 0; iBatch < gNumTests; iBatch += NUMLANES) {
+			const unsigned numLanes = (gNumTests - iBatch < NUMLANES) ? gNumTests - iBatch : NUMLANES;
+			const uint64_t laneMask = (numLanes == NUMLANES) ? ~0ULL : (1ULL << numLanes) - 1;
+
+			testData.assign(testNames.size(), 0);
+
+			// convert ascii to hex and inject at the appropriate location
+			for (unsigned iLane = 0; iLane < numLanes; iLane++) {
+				const unsigned iTest   = iBatch + iLane;
+				const uint64_t laneBit = 1ULL << iLane;
+
+				/*
+				 * Load/decode the test 
+				 */
+
+				// extract test element
+				json_t     *jTest    = json_array_get(jTests, iTest);
+				const char *strEntry = json_string_value(json_array_get(jTest, 0));
+				const char *strRoots = json_string_value(json_array_get(jTest, 1));
+
+				// simple validation
+				if (!strEntry || !strRoots) {
+					json_t *jError = json_object();
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Incomplete test entry"));
+					json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+					json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
 
-				unsigned byte = 0;
+				/*
+				 * decode entrypoint/root data
+				 */
+				unsigned iBit   = 0;
+
+				// convert
+				for (unsigned iPos = 0; iPos < strlen(strEntry); /* increment in loop */ ) {
+					// skip spaces
+					if (isspace(strEntry[iPos])) {
+						iPos++;
+						continue;
+					}
 
-				for (int iNibble = 0; iNibble < 2; iNibble++) {
-					char ch = strRoots[iPos++]; // loop increment happens here
+					unsigned byte = 0;
 
-					byte *= 16;
+					for (int iNibble = 0; iNibble < 2; iNibble++) {
+						char ch = strEntry[iPos++]; // loop decrement happens here
 
-					if (ch >= '0' && ch <= '9')
-						byte += ch - '0';
-					else if (ch >= 'A' && ch <= 'F')
-						byte += ch - 'A' + 10;
-					else if (ch >= 'a' && ch <= 'f')
-						byte += ch - 'a' + 10;
-					else {
-						json_t *jError = json_object();
-						json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad root data in test entry"));
-						json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-						json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-						json_object_set_new_nocheck(jError, "root-data", json_string_nocheck(strRoots));
-						ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+						byte *= 16;
+
+						if (ch >= '0' && ch <= '9')
+							byte += ch - '0';
+						else if (ch >= 'A' && ch <= 'F')
+							byte += ch - 'A' + 10;
+						else if (ch >= 'a' && ch <= 'f')
+							byte += ch - 'a' + 10;
+						else {
+							json_t *jError = json_object();
+							json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad entry data in test entry"));
+							json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+							json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+							json_object_set_new_nocheck(jError, "key-data", json_string_nocheck(strEntry));
+							ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+						}
+					}
+
+					for (unsigned k = 0; k < 8; k++) {
+						if (iBit < jsonTree.nstart - jsonTree.kstart) {
+							if (byte & (1 << k))
+								testData[iBit] |= laneBit;
+							iBit++;
+						}
 					}
 				}
 
-				for (unsigned k = 0; k < 8; k++) {
-					if (iBit < (jsonTree.nstart - jsonTree.kstart) + jsonTree.numRoots)
-						testData[iBit++] = (byte & (1 << k)) ? ~0U : 0U;
+				if (iBit < jsonTree.nstart - jsonTree.kstart) {
+					json_t *jError = json_object();
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("entry data too short in test entry"));
+					json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+					json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+					json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.nstart - jsonTree.kstart));
+					json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
+					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
-			}
 
-			if (iBit < jsonTree.numRoots) {
-				json_t *jError = json_object();
-				json_object_set_new_nocheck(jError, "error", json_string_nocheck("root data too short in test entry"));
-				json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
-				json_object_set_new_nocheck(jError, "test", json_integer(iTest));
-				json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.numRoots));
-				json_object_set_new_nocheck(jError, "numroots", json_integer(iBit));
-				json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
-				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+				// convert
+				for (unsigned iPos = 0; iPos < strlen(strRoots); /* increment in loop */ ) {
+					// skip spaces
+					if (isspace(strRoots[iPos])) {
+						iPos++;
+						continue;
+					}
+
+					unsigned byte = 0;
+
+					for (int iNibble = 0; iNibble < 2; iNibble++) {
+						char ch = strRoots[iPos++]; // loop increment happens here
+
+						byte *= 16;
+
+						if (ch >= '0' && ch <= '9')
+							byte += ch - '0';
+						else if (ch >= 'A' && ch <= 'F')
+							byte += ch - 'A' + 10;
+						else if (ch >= 'a' && ch <= 'f')
+							byte += ch - 'a' + 10;
+						else {
+							json_t *jError = json_object();
+							json_object_set_new_nocheck(jError, "error", json_string_nocheck("bad root data in test entry"));
+							json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+							json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+							json_object_set_new_nocheck(jError, "root-data", json_string_nocheck(strRoots));
+							ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+						}
+					}
+
+					for (unsigned k = 0; k < 8; k++) {
+						if (iBit < (jsonTree.nstart - jsonTree.kstart) + jsonTree.numRoots) {
+							if (byte & (1 << k))
+								testData[iBit] |= laneBit;
+							iBit++;
+						}
+					}
+				}
+
+				if (iBit < jsonTree.numRoots) {
+					json_t *jError = json_object();
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("root data too short in test entry"));
+					json_object_set_new_nocheck(jError, "filename", json_string(jsonFilename));
+					json_object_set_new_nocheck(jError, "test", json_integer(iTest));
+					json_object_set_new_nocheck(jError, "expected", json_integer(jsonTree.numRoots));
+					json_object_set_new_nocheck(jError, "numroots", json_integer(iBit));
+					json_object_set_new_nocheck(jError, "encountered", json_integer(iBit));
+					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+				}
 			}
 
 			/*
 			 * Prepare evaluator
 			 */
 
-			// set everything to an invalidation marker
-			for (unsigned iNode = 0; iNode < tree.ncount; iNode++)
-				pEval[iNode] = 0x5a5a5a5a; // set to invalid value
-
 			pEval[0] = 0; // only zero is well-defined
 
 			for (unsigned iEntry = tree.kstart; iEntry < tree.nstart; iEntry++)
 				pEval[iEntry] = testData[entryMap[iEntry - tree.kstart]];
 
 			/*
-			 * Run the test
+			 * Run the tests
 			 */
+			// lanes where group members differ, with the first offending group/node per lane
+			uint64_t groupFailed = 0;
+			uint32_t firstGid[NUMLANES];
+			uint32_t firstNid[NUMLANES];
+
 			// find group headers
 			for (uint32_t iGroup = tree.nstart; iGroup < tree.ncount; iGroup++) {
 				if (tree.N[iGroup].gid != iGroup)
@@ -405,161 +497,99 @@ struct bvalidateContext_t {
 
 				bool once = true;
 
-				// walk through group list in search of a `1n9` node
+				// all members of the group should evaluate identical
 				for (uint32_t iNode = tree.N[iGroup].next; iNode != iGroup; iNode = tree.N[iNode].next) {
-					groupNode_t *pNode = tree.N + iNode;
-
-					for (unsigned iSlot = 0; iSlot < pStore->signatures[pNode->sid].numPlaceholder; iSlot++) {
-						uint32_t id = pNode->slots[iSlot];
-						
-						// test range
-						if (id == 0 || id >= tree.ncount) {
-							json_t *jError = json_object();
-							json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node references out-of-range"));
-							json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-							json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-							json_object_set_new_nocheck(jError, "gid", json_integer(iGroup));
-							json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
-							json_object_set_new_nocheck(jError, "slot", json_integer(iSlot));
-							json_object_set_new_nocheck(jError, "id", json_integer(id));
-							ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-						}
-
-						// test for undefined
-						if (pEval[id] != 0 && pEval[id] != ~0U) {
-							json_t *jError = json_object();
-							json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node values out-of-range"));
-							json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-							json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-							json_object_set_new_nocheck(jError, "gid", json_integer(iGroup));
-							json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
-							json_object_set_new_nocheck(jError, "slot", json_integer(iSlot));
-							json_object_set_new_nocheck(jError, "id", json_integer(id));
-							json_object_set_new_nocheck(jError, "value", json_integer(pEval[id]));
-							ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-						}
-					}
-
-					uint32_t ev = tree.evalNode(iNode, pEval);
+					uint64_t ev = tree.evalNode(iNode, pEval);
 
 					if (once) {
 						pEval[iGroup] = ev;
 						once = false;
-					} else if (pEval[iGroup] != ev) {
-						json_t *jError = json_object();
-						json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node values out-of-range"));
-						json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-						json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-						json_object_set_new_nocheck(jError, "gid", json_integer(iGroup));
-						json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
-						json_object_set_new_nocheck(jError, "expected", json_integer(pEval[iGroup]));
-						json_object_set_new_nocheck(jError, "encountered", json_integer(ev));
-						ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+					} else {
+						// lanes differing for the first time
+						for (uint64_t newFailed = (pEval[iGroup] ^ ev) & laneMask & ~groupFailed; newFailed; newFailed &= newFailed - 1) {
+							unsigned iLane = __builtin_ctzll(newFailed);
+
+							firstGid[iLane] = iGroup;
+							firstNid[iLane] = iNode;
+							groupFailed |= 1ULL << iLane;
+						}
 					}
 				}
 			}
-			
-#if 0
-			for (uint32_t iNode = tree.nstart; iNode < tree.ncount; iNode++) {
-				const groupNode_t *pNode = tree.N + iNode;
-				const uint32_t   Q      = 0;
-				const uint32_t   Ti     = 0;
-				const uint32_t   Tu     = 0;
-				const uint32_t   F      = 0;
-
-				// test range
-				if (Q >= tree.ncount || Tu >= tree.ncount || F >= tree.ncount) {
-					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node references out-of-range"));
-					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
-					json_t *jNode = json_object();
-					json_object_set_new_nocheck(jNode, "q", json_integer(Q));
-					json_object_set_new_nocheck(jNode, "ti", json_integer(Ti ? 1 : 0));
-					json_object_set_new_nocheck(jNode, "tu", json_integer(Tu));
-					json_object_set_new_nocheck(jNode, "f", json_integer(F));
-					json_object_set_new_nocheck(jError, "node", jNode);
-					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-				}
-
-				// test for undefined
-				if ((pEval[Q] != 0 && pEval[Q] != ~0U) || (pEval[Tu] != 0 && pEval[Tu] != ~0U) || (pEval[F] != 0 && pEval[F] != ~0U)) {
-					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node values out-of-range"));
-					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					json_object_set_new_nocheck(jError, "nid", json_integer(iNode));
-					json_t *jNode = json_object();
-					json_object_set_new_nocheck(jNode, "q", json_integer(Q));
-					json_object_set_new_nocheck(jNode, "ti", json_integer(Ti ? 1 : 0));
-					json_object_set_new_nocheck(jNode, "tu", json_integer(Tu));
-					json_object_set_new_nocheck(jNode, "f", json_integer(F));
-					json_object_set_new_nocheck(jError, "node", jNode);
-					json_t *jValue = json_object();
-					json_object_set_new_nocheck(jValue, "q", json_integer(pEval[Q]));
-					json_object_set_new_nocheck(jValue, "ti", json_integer(pEval[Tu] & IBIT ? 1 : 0));
-					json_object_set_new_nocheck(jValue, "tu", json_integer(pEval[Tu] & ~IBIT));
-					json_object_set_new_nocheck(jValue, "f", json_integer(pEval[F]));
-					json_object_set_new_nocheck(jError, "value", jValue);
-					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-				}
-
-				/*
-				 * Apply QTF operator
-				 */
-
-				// determine if the operator is `QTF` or `QnTF`
-				if (Ti) {
-					// `QnTF` apply the operator `"Q ? ~T : F"`
-					pEval[iNode] = (pEval[Q] & ~pEval[Tu]) ^ (~pEval[Q] & pEval[F]);
-				} else {
-					// `QTF` apply the operator `"Q ? T : F"`
-					pEval[iNode] = (pEval[Q] & pEval[Tu]) ^ (~pEval[Q] & pEval[F]);
-				}
-			}
-#endif
 
 			/*
 			 * Compare the results for the provides
 			 */
+			uint64_t rootFailed = 0;
+			unsigned firstRoot[NUMLANES]; // first failing root per lane
+
 			for (unsigned iRoot = 0; iRoot < tree.numRoots; iRoot++) {
-				uint32_t expected = (tree.flags & context_t::MAGICMASK_SYSTEM) ? 0 : testData[rootMap[iRoot]];
+				uint64_t expected = (tree.flags & context_t::MAGICMASK_SYSTEM) ? 0 : testData[rootMap[iRoot]];
 				uint32_t R = tree.roots[iRoot];
-				uint32_t encountered = pEval[R & ~IBIT];
+				uint64_t encountered = pEval[R & ~IBIT];
 				if (R & IBIT)
-					encountered ^= ~0U;
+					encountered ^= ~0ULL;
 
-				// test for undefined. Initial value `pEval[]` is 0x5a5a5a5a.
-				if (pEval[R & ~IBIT] != 0 && pEval[R & ~IBIT] != ~0U) {
-					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Root loads undefined"));
-					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
-					json_object_set_new_nocheck(jError, "value", json_integer(pEval[R & ~IBIT]));
-					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
-				}
+				// lanes that failed
+				uint64_t failed = (expected ^ encountered) & laneMask;
+				if (opt_onlyIfSet)
+					failed &= encountered;
+
+				// lanes failing for the first time
+				for (uint64_t newFailed = failed & ~rootFailed; newFailed; newFailed &= newFailed - 1)
+					firstRoot[__builtin_ctzll(newFailed)] = iRoot;
+
+				rootFailed |= failed;
+			}
+
+			/*
+			 * Report the first failing test of the batch.
+			 * Like a test-by-test run would, groups are checked before roots.
+			 */
+			if (groupFailed | rootFailed) {
+				unsigned iLane = __builtin_ctzll(groupFailed | rootFailed);
+
+				if (groupFailed & (1ULL << iLane)) {
+					uint32_t iGroup   = firstGid[iLane];
+					uint64_t expected = (pEval[iGroup] >> iLane) & 1;
 
-				if ((!opt_onlyIfSet || encountered) && expected != encountered) {
 					json_t *jError = json_object();
-					json_object_set_new_nocheck(jError, "error", json_string_nocheck("validation failed"));
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("Node values out-of-range"));
 					json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
-					json_object_set_new_nocheck(jError, "testnr", json_integer(iTest));
-					if (tree.flags & context_t::MAGICMASK_SYSTEM)
-						json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
-					else
-						json_object_set_new_nocheck(jError, "root", json_string(testNames[rootMap[iRoot]].c_str()));
-					json_object_set_new_nocheck(jError, "expected", json_integer(expected));
-					json_object_set_new_nocheck(jError, "encountered", json_integer(encountered));
+					json_object_set_new_nocheck(jError, "testnr", json_integer(iBatch + iLane));
+					json_object_set_new_nocheck(jError, "gid", json_integer(iGroup));
+					json_object_set_new_nocheck(jError, "nid", json_integer(firstNid[iLane]));
+					json_object_set_new_nocheck(jError, "expected", json_integer(expected ? ~0U : 0U));
+					json_object_set_new_nocheck(jError, "encountered", json_integer(expected ? 0U : ~0U));
 					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 				}
+
+				unsigned iRoot = firstRoot[iLane];
+
+				uint64_t expected = (tree.flags & context_t::MAGICMASK_SYSTEM) ? 0 : testData[rootMap[iRoot]];
+				uint32_t R = tree.roots[iRoot];
+				uint64_t encountered = pEval[R & ~IBIT];
+				if (R & IBIT)
+					encountered ^= ~0ULL;
+
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("validation failed"));
+				json_object_set_new_nocheck(jError, "filename", json_string(treeFilename));
+				json_object_set_new_nocheck(jError, "testnr", json_integer(iBatch + iLane));
+				if (tree.flags & context_t::MAGICMASK_SYSTEM)
+					json_object_set_new_nocheck(jError, "root", json_string(tree.rootNames[iRoot].c_str()));
+				else
+					json_object_set_new_nocheck(jError, "root", json_string(testNames[rootMap[iRoot]].c_str()));
+				json_object_set_new_nocheck(jError, "expected", json_integer((expected >> iLane) & 1 ? ~0U : 0U));
+				json_object_set_new_nocheck(jError, "encountered", json_integer((encountered >> iLane) & 1 ? ~0U : 0U));
+				json_object_set_new_nocheck(jError, "numfailed", json_integer(__builtin_popcountll(rootFailed)));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
 			}
 		}
 
 		fprintf(stderr, "Passed %d tests\n", gNumTests);
 
-		tree.freeMap(pEval);
+		ctx.myFree("bvalidateContext_t::pEval", pEval);
 		json_delete(jInput);
 	}
 };
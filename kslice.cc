@@ -30,10 +30,12 @@
 #include <getopt.h>
 #include <jansson.h>
 #include <stdlib.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include "context.h"
 #include "basetree.h"
+#include "slicefile.h"
 
 /*
  * Resource context.
@@ -68,6 +70,8 @@ void sigalrmHandler(int __attribute__ ((unused)) sig) {
  */
 struct ksliceContext_t {
 
+	/// @var {number} --container, write all slices into a single `sliceFile_t` container
+	unsigned opt_container;
 	/// @var {number} header flags
 	uint32_t opt_flags;
 	/// @var {number} --force, force overwriting of outputs if already exists
@@ -78,19 +82,34 @@ struct ksliceContext_t {
 	unsigned opt_sql;
 	/// @var {number} --threshold, Nodes referenced at least this number of times get their own file
 	unsigned opt_threshold;
+	/// @var {number} --workers, Number of processes extracting heads
+	unsigned opt_workers;
 
 	/// @var {baseTree_t*} input tree
 	baseTree_t *pInputTree;
 
 	ksliceContext_t() {
+		opt_container = 0;
 		opt_flags     = 0;
 		opt_force     = 0;
 		opt_maxNode   = DEFAULT_MAXNODE;
 		opt_sql       = 0;
 		opt_threshold = 2;
+		opt_workers   = 1;
 		pInputTree    = NULL;
 	}
 
+	/*
+	 * @date 2022-03-13 23:45:20
+	 *
+	 * Name of partial container written by a worker
+	 */
+	static std::string partName(const char *outputTemplate, unsigned iWorker) {
+		char sbuf[32];
+		sprintf(sbuf, ".part%u", iWorker);
+		return std::string(outputTemplate) + sbuf;
+	}
+
 	/**
 	 * @date 2021-05-19 17:00:36
 	 *
@@ -206,17 +225,22 @@ struct ksliceContext_t {
 		 * Setup entry/root names
 		 */
 
-		for (unsigned iEntry = 0; iEntry < pNewTree->estart; iEntry++)
-			pNewTree->entryNames[iEntry] = pOldTree->entryNames[iEntry];
+		for (unsigned iEntry = pNewTree->kstart; iEntry < pNewTree->estart; iEntry++)
+			pNewTree->entryNames[iEntry - pNewTree->kstart] = pOldTree->entryNames[iEntry - pOldTree->kstart];
 
 		for (unsigned iEntry = pNewTree->estart; iEntry < pNewTree->nstart; iEntry++) {
 			char sbuf[32];
 			sprintf(sbuf, "e%0*d", entryNameLength, iEntry);
-			pNewTree->entryNames[iEntry] = sbuf;
+			pNewTree->entryNames[iEntry - pNewTree->kstart] = sbuf;
 		}
 
-		// root has same names as keys
-		pNewTree->rootNames = pNewTree->entryNames;
+		// root has same names as keys, roots are indexed by node id
+		for (unsigned iRoot = 0; iRoot < pNewTree->numRoots; iRoot++) {
+			if (iRoot >= pNewTree->kstart && iRoot < pNewTree->nstart)
+				pNewTree->rootNames[iRoot] = pNewTree->entryNames[iRoot - pNewTree->kstart];
+			else if (iRoot < pOldTree->numRoots)
+				pNewTree->rootNames[iRoot] = pOldTree->rootNames[iRoot];
+		}
 
 		/*
 		 * All preparations done
@@ -237,6 +261,74 @@ struct ksliceContext_t {
 
 		uint32_t nextExtend = pNewTree->estart;
 
+		/*
+		 * @date 2022-03-13 23:44:10
+		 *
+		 * Assign extended keys up front.
+		 * Extracting a head only reads `pOldTree` and `pEid[]`, this makes all heads independent of each other.
+		 */
+		for (uint32_t iHead = pOldTree->nstart; iHead < pOldTree->ncount; iHead++) {
+			if (pRefCount[iHead] >= opt_threshold)
+				pEid[iHead] = nextExtend++;
+		}
+		assert(nextExtend == pNewTree->nstart);
+
+		/*
+		 * @date 2022-03-13 23:44:37
+		 *
+		 * With `--workers`, heads are distributed round-robin over forked processes.
+		 * Each process has its own copy-on-write `pNewTree` and maps.
+		 * Distribution starts with the last head so the summary of the main process matches a single process run.
+		 * `--sql` output is ordered and stays single process.
+		 */
+		unsigned           numWorkers = (opt_sql || opt_workers < 1) ? 1 : opt_workers;
+		unsigned           iWorker    = 0;
+		std::vector<pid_t> workerPids;
+
+		if (numWorkers > numExtended)
+			numWorkers = numExtended;
+
+		if (opt_container && !opt_force) {
+			struct stat sbuf;
+			if (!stat(outputTemplate, &sbuf)) {
+				json_t *jError = json_object();
+				json_object_set_new_nocheck(jError, "error", json_string_nocheck("file already exists. Use --force to overwrite"));
+				json_object_set_new_nocheck(jError, "filename", json_string(outputTemplate));
+				ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			}
+		}
+
+		// flush before fork to avoid duplicate output
+		fflush(stdout);
+		fflush(stderr);
+
+		for (unsigned i = 1; i < numWorkers; i++) {
+			pid_t pid = fork();
+			if (pid < 0)
+				ctx.fatal("fork() returned: %m\n");
+			if (pid == 0) {
+				iWorker = i;
+				workerPids.clear();
+				break;
+			}
+			workerPids.push_back(pid);
+		}
+
+		/*
+		 * @date 2022-03-13 23:25:02
+		 *
+		 * With `--container`, slices are appended to a single file instead of one file per head.
+		 * Multiple workers each write a partial container which is merged afterwards.
+		 */
+		sliceFile_t slices(ctx);
+
+		if (opt_container) {
+			if (numWorkers > 1)
+				slices.create(partName(outputTemplate, iWorker).c_str());
+			else
+				slices.create(outputTemplate);
+		}
+
 		// reset ticker
 		ctx.setupSpeed(pOldTree->ncount - pOldTree->nstart);
 		ctx.tick = 0;
@@ -253,13 +345,20 @@ struct ksliceContext_t {
 			if (pRefCount[iHead] < opt_threshold)
 				continue; // no
 
+			// only heads of this worker
+			if ((pNewTree->nstart - 1 - pEid[iHead]) % numWorkers != iWorker)
+				continue;
+
 			char *filename;
-			asprintf(&filename, outputTemplate, nextExtend);
+			if (opt_container)
+				asprintf(&filename, "%s#%u", outputTemplate, pEid[iHead]); // label for messages
+			else
+				asprintf(&filename, outputTemplate, pEid[iHead]);
 
 			/*
 			 * file may not exist
 			 */
-			if (!opt_force) {
+			if (!opt_container && !opt_force) {
 				struct stat sbuf;
 				if (!stat(filename, &sbuf)) {
 					json_t *jError = json_object();
@@ -272,7 +371,7 @@ struct ksliceContext_t {
 				}
 			}
 
-			if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK) {
+			if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK && iWorker == 0) {
 				int perSecond = ctx.updateSpeed();
 
 				int eta  = (int) ((ctx.progressHi - ctx.progress) / perSecond);
@@ -293,16 +392,12 @@ struct ksliceContext_t {
 			 */
 			pNewTree->rewind();
 
-			// assign extended key to head
-			assert(nextExtend < pNewTree->nstart);
-			pEid[iHead] = nextExtend++;
-
 			/*
 			 * select sub-tree in old tree
 			 */
 			thisVersion = ++pOldTree->mapVersionNr;
 			if (thisVersion == 0) {
-				::memset(pSelect, 0, pOldTree->maxNodes * sizeof *pSelect);
+				context_t::myClearLazy(pSelect, pOldTree->maxNodes * sizeof *pSelect);
 				thisVersion = ++pOldTree->mapVersionNr;
 			}
 
@@ -403,13 +498,100 @@ struct ksliceContext_t {
 			/*
 			 * Save tree
 			 */
-			pNewTree->saveFile(filename, false);
+			if (opt_container)
+				slices.append(*pNewTree, pEid[iHead]);
+			else
+				pNewTree->saveFile(filename, false);
 			numSaves++;
 
 			// release filename
 			free(filename);
 		}
-		assert(nextExtend == pNewTree->nstart);
+
+		if (opt_container)
+			slices.close();
+
+		if (iWorker != 0) {
+			// worker done
+			fflush(stdout);
+			fflush(stderr);
+			_exit(0);
+		}
+
+		// wait for all workers before reporting, a running worker could still be writing its partial container
+		unsigned failedWorker = 0;
+		int      failedStatus = 0;
+
+		for (unsigned i = 0; i < workerPids.size(); i++) {
+			int status;
+			if (waitpid(workerPids[i], &status, 0) < 0)
+				ctx.fatal("waitpid() returned: %m\n");
+			if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+				if (failedWorker == 0) {
+					failedWorker = i + 1;
+					failedStatus = status;
+				}
+			}
+			numSaves += (numExtended + numWorkers - 1 - (i + 1)) / numWorkers; // heads of worker `i+1`
+		}
+
+		if (failedWorker != 0) {
+			if (opt_container) {
+				for (unsigned i = 0; i < numWorkers; i++)
+					unlink(partName(outputTemplate, i).c_str());
+			}
+
+			json_t *jError = json_object();
+			json_object_set_new_nocheck(jError, "error", json_string_nocheck("worker failed"));
+			json_object_set_new_nocheck(jError, "worker", json_integer(failedWorker));
+			json_object_set_new_nocheck(jError, "status", json_integer(failedStatus));
+			ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		if (opt_container && numWorkers > 1) {
+			/*
+			 * Merge partial containers, in order of extended key
+			 */
+			std::vector<sliceFile_t *> parts(numWorkers);
+			std::vector<uint32_t>      nextSlice(numWorkers);
+
+			for (unsigned i = 0; i < numWorkers; i++) {
+				parts[i] = new sliceFile_t(ctx);
+				parts[i]->open(partName(outputTemplate, i).c_str());
+				nextSlice[i] = 0;
+			}
+
+			slices.create(outputTemplate);
+
+			for (uint32_t iExtend = 0; iExtend < numExtended; iExtend++) {
+				unsigned          iPart  = (numExtended - 1 - iExtend) % numWorkers;
+				const sliceFile_t *pPart = parts[iPart];
+
+				// validate before dereferencing, partial containers are external input
+				if (nextSlice[iPart] >= pPart->numSlices ||
+				    pPart->directory[nextSlice[iPart]].id != pNewTree->estart + iExtend ||
+				    pPart->directory[nextSlice[iPart]].offset + pPart->directory[nextSlice[iPart]].length > pPart->fileHeader->offEnd) {
+					json_t *jError = json_object();
+					json_object_set_new_nocheck(jError, "error", json_string_nocheck("partial container mismatch"));
+					json_object_set_new_nocheck(jError, "filename", json_string(partName(outputTemplate, iPart).c_str()));
+					json_object_set_new_nocheck(jError, "slice", json_integer(nextSlice[iPart]));
+					json_object_set_new_nocheck(jError, "numslices", json_integer(pPart->numSlices));
+					json_object_set_new_nocheck(jError, "expected", json_integer(pNewTree->estart + iExtend));
+					ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+				}
+
+				const sliceFileEntry_t *pEntry = pPart->directory + nextSlice[iPart]++;
+
+				slices.appendImage(pPart->rawData + pEntry->offset, pEntry->length, pEntry->id);
+			}
+
+			slices.close();
+
+			for (unsigned i = 0; i < numWorkers; i++) {
+				delete parts[i];
+				unlink(partName(outputTemplate, i).c_str());
+			}
+		}
 
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
 			fprintf(stderr, "\r\e[K");
@@ -449,6 +631,7 @@ ksliceContext_t app;
 void usage(char *argv[], bool verbose) {
 	fprintf(stderr, "usage: %s <outputTemplate.dat> <input.dat> # NOTE: 'outputTemplate' is a sprintf template\n", argv[0]);
 	if (verbose) {
+		fprintf(stderr, "\t   --container  # NOTE: 'outputTemplate' is the container filename\n");
 		fprintf(stderr, "\t   --force\n");
 		fprintf(stderr, "\t   --maxnode=<number> [default=%d]\n", app.opt_maxNode);
 		fprintf(stderr, "\t-q --quiet\n");
@@ -456,6 +639,7 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --sql\n");
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
 		fprintf(stderr, "\t-v --verbose\n");
+		fprintf(stderr, "\t   --workers=<number> [default=%d]\n", app.opt_workers);
 		fprintf(stderr, "\t   --[no-]paranoid [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PARANOID ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]pure [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]rewrite [default=%s]\n", app.opt_flags & ctx.MAGICMASK_REWRITE ? "enabled" : "disabled");
@@ -481,13 +665,14 @@ int main(int argc, char *argv[]) {
 
 	for (;;) {
 		enum {
-			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE, LO_THRESHOLD, LO_SQL,
+			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_CONTAINER, LO_FORCE, LO_MAXNODE, LO_THRESHOLD, LO_SQL, LO_WORKERS,
 			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE, LO_SHRINK, LO_NOSHRINK, LO_PIVOT3, LO_NOPIVOT3,
 			LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
 
 		static struct option long_options[] = {
 			/* name, has_arg, flag, val */
+			{"container",   0, 0, LO_CONTAINER},
 			{"debug",       1, 0, LO_DEBUG},
 			{"force",       0, 0, LO_FORCE},
 			{"help",        0, 0, LO_HELP},
@@ -497,6 +682,7 @@ int main(int argc, char *argv[]) {
 			{"timer",       1, 0, LO_TIMER},
 			{"threshold",   1, 0, LO_THRESHOLD},
 			{"verbose",     2, 0, LO_VERBOSE},
+			{"workers",     1, 0, LO_WORKERS},
 			//
 			{"paranoid",    0, 0, LO_PARANOID},
 			{"no-paranoid", 0, 0, LO_NOPARANOID},
@@ -536,6 +722,9 @@ int main(int argc, char *argv[]) {
 			break;
 
 		switch (c) {
+		case LO_CONTAINER:
+			app.opt_container++;
+			break;
 		case LO_DEBUG:
 			ctx.opt_debug = (unsigned) strtoul(optarg, NULL, 8); // OCTAL!!
 			break;
@@ -563,6 +752,9 @@ int main(int argc, char *argv[]) {
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
 			break;
+		case LO_WORKERS:
+			app.opt_workers = (unsigned) strtoul(optarg, NULL, 10);
+			break;
 
 		case LO_PARANOID:
 			app.opt_flags |= ctx.MAGICMASK_PARANOID;
@@ -0,0 +1,337 @@
+#ifndef _SLICEFILE_H
+#define _SLICEFILE_H
+
+/*
+ * @date 2022-03-13 23:20:41
+ *
+ * Container holding many `baseTree_t` images in a single file.
+ * `kslice` can split a tree into hundreds of thousands of slices, one file each makes the filesystem the bottleneck.
+ *
+ * Layout:
+ *   - header
+ *   - images, each as written by `baseTree_t::saveImage()`, 64-byte aligned
+ *   - directory, one `sliceFileEntry_t` per image
+ *
+ * The container is `mmap()`ed once and slices are attached in-place with `baseTree_t::loadImage()`.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2022, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "context.h"
+#include "basetree.h"
+
+/*
+ * Version number of container file
+ */
+#define SLICEFILE_MAGIC 0x20220314
+
+/*
+ * The container file header
+ */
+struct sliceFileHeader_t {
+	uint32_t magic;               // magic+version
+	uint32_t numSlices;           // entries in directory
+	uint64_t offDirectory;        // location of directory
+	uint64_t offEnd;              // file size
+};
+
+/*
+ * Directory entry
+ */
+struct sliceFileEntry_t {
+	uint64_t offset;              // start of image
+	uint64_t length;              // length of image
+	uint32_t id;                  // user supplied identifier, `kslice` uses the extended key id
+	uint32_t unused;              //
+};
+
+struct sliceFile_t {
+
+	/// @var {context_t} I/O context
+	context_t &ctx;
+
+	// reading
+	int                     hndl;         // file handle
+	uint8_t                 *rawData;     // base location of mmap segment
+	const sliceFileHeader_t *fileHeader;  // file header
+	const sliceFileEntry_t  *directory;   // directory
+	uint32_t                numSlices;    // number of slices
+
+	// writing
+	FILE                          *outf;         // output stream
+	std::string                   outFileName;   // name of output, for error messages
+	std::vector<sliceFileEntry_t> newDirectory;  // directory being constructed
+
+	sliceFile_t(context_t &ctx) :
+		ctx(ctx),
+		hndl(-1),
+		rawData(NULL),
+		fileHeader(NULL),
+		directory(NULL),
+		numSlices(0),
+		outf(NULL),
+		outFileName(),
+		newDirectory() {
+	}
+
+	/*
+	 * Release system resources
+	 */
+	~sliceFile_t() {
+		if (outf)
+			close();
+
+		if (hndl >= 0) {
+			int ret;
+			ret = ::munmap((void *) rawData, fileHeader->offEnd);
+			if (ret)
+				ctx.fatal("munmap() returned: %m\n");
+			ret = ::close(hndl);
+			if (ret)
+				ctx.fatal("close() returned: %m\n");
+		}
+
+		// zombies need to trigger SEGV
+		rawData    = NULL;
+		fileHeader = NULL;
+		directory  = NULL;
+	}
+
+	/*
+	 * @date 2022-03-13 23:21:30
+	 *
+	 * Test if file is a container
+	 */
+	static bool isSliceFile(const char *fileName) {
+		uint32_t magic = 0;
+
+		int fd = ::open(fileName, O_RDONLY);
+		if (fd < 0)
+			return false;
+		if (::read(fd, &magic, sizeof magic) != sizeof magic)
+			magic = 0;
+		::close(fd);
+
+		return magic == SLICEFILE_MAGIC;
+	}
+
+	/*
+	 * @date 2022-03-13 23:21:44
+	 *
+	 * Open container for reading
+	 */
+	void open(const char *fileName) {
+		if (hndl >= 0 || outf)
+			ctx.fatal("sliceFile_t::open() on non-initial container\n");
+
+		hndl = ::open(fileName, O_RDONLY);
+		if (hndl == -1)
+			ctx.fatal("fopen(\"%s\",\"r\") returned: %m\n", fileName);
+
+		struct stat stbuf;
+		if (fstat(hndl, &stbuf))
+			ctx.fatal("fstat(\"%s\") returned: %m\n", fileName);
+
+		if ((uint64_t) stbuf.st_size < sizeof(sliceFileHeader_t))
+			ctx.fatal("sliceFile too short. Encountered %lu\n", (uint64_t) stbuf.st_size);
+
+		void *pMemory = mmap(NULL, (size_t) stbuf.st_size, PROT_READ, MAP_SHARED | MAP_NORESERVE, hndl, 0);
+		if (pMemory == MAP_FAILED)
+			ctx.fatal("mmap(PROT_READ, MAP_SHARED|MAP_NORESERVE,%s) returned: %m\n", fileName);
+
+		// slices are typically accessed once and in order. NOTE: advice values are not flags
+		if (madvise(pMemory, (size_t) stbuf.st_size, MADV_SEQUENTIAL))
+			ctx.fatal("madvise(MADV_SEQUENTIAL) returned: %m\n");
+		if (madvise(pMemory, (size_t) stbuf.st_size, MADV_DONTDUMP))
+			ctx.fatal("madvise(MADV_DONTDUMP) returned: %m\n");
+
+		rawData    = (uint8_t *) pMemory;
+		fileHeader = (const sliceFileHeader_t *) rawData;
+
+		if (fileHeader->magic != SLICEFILE_MAGIC)
+			ctx.fatal("sliceFile version mismatch. Expected %08x, Encountered %08x\n", SLICEFILE_MAGIC, fileHeader->magic);
+		if (fileHeader->offEnd != (uint64_t) stbuf.st_size)
+			ctx.fatal("sliceFile size mismatch. Expected %lu, Encountered %lu\n", fileHeader->offEnd, (uint64_t) stbuf.st_size);
+		if (fileHeader->offDirectory + fileHeader->numSlices * sizeof(*directory) > fileHeader->offEnd)
+			ctx.fatal("sliceFile directory out of range\n");
+
+		numSlices = fileHeader->numSlices;
+		directory = (const sliceFileEntry_t *) (rawData + fileHeader->offDirectory);
+	}
+
+	/*
+	 * @date 2022-03-13 23:22:10
+	 *
+	 * Attach a slice to an initial tree.
+	 * The tree uses the container memory in-place and must be released before the container.
+	 *
+	 * return 0 for ok.
+	 */
+	unsigned loadSlice(uint32_t iSlice, baseTree_t &tree) const {
+		if (iSlice >= numSlices)
+			ctx.fatal("\n{\"error\":\"slice out of range\",\"where\":\"%s:%s:%d\",\"slice\":%u,\"numslices\":%u}\n",
+				  __FUNCTION__, __FILE__, __LINE__, iSlice, numSlices);
+
+		const sliceFileEntry_t *pEntry = directory + iSlice;
+
+		if (pEntry->offset + pEntry->length > fileHeader->offDirectory)
+			ctx.fatal("\n{\"error\":\"slice image out of range\",\"where\":\"%s:%s:%d\",\"slice\":%u}\n",
+				  __FUNCTION__, __FILE__, __LINE__, iSlice);
+
+		return tree.loadImage(rawData + pEntry->offset, pEntry->length);
+	}
+
+	/*
+	 * @date 2022-03-13 23:22:41
+	 *
+	 * Create container for writing
+	 */
+	void create(const char *fileName) {
+		if (hndl >= 0 || outf)
+			ctx.fatal("sliceFile_t::create() on non-initial container\n");
+
+		outf = fopen(fileName, "w");
+		if (!outf)
+			ctx.fatal("Failed to open %s: %m\n", fileName);
+
+		outFileName = fileName;
+		newDirectory.clear();
+
+		// write empty header (overwritten later)
+		sliceFileHeader_t header;
+		memset(&header, 0, sizeof header);
+		fwrite(&header, sizeof header, 1, outf);
+	}
+
+	/*
+	 * @date 2022-03-13 23:22:58
+	 *
+	 * Append a tree as next slice
+	 *
+	 * @param {baseTree_t} tree - Tree to save
+	 * @param {number} id - identifier stored in directory
+	 * @return {number} - slice number
+	 */
+	uint32_t append(baseTree_t &tree, uint32_t id) {
+		assert(outf);
+
+		alignOutput();
+
+		sliceFileEntry_t entry;
+		entry.offset = (uint64_t) ftello(outf);
+		entry.length = tree.saveImage(outf, outFileName.c_str());
+		entry.id     = id;
+		entry.unused = 0;
+
+		newDirectory.push_back(entry);
+
+		return newDirectory.size() - 1;
+	}
+
+	/*
+	 * @date 2022-03-13 23:45:52
+	 *
+	 * Append an already serialised image, as found in another container
+	 *
+	 * @param {uint8_t*} pImage - image as written by `baseTree_t::saveImage()`
+	 * @param {number} length - length of image
+	 * @param {number} id - identifier stored in directory
+	 * @return {number} - slice number
+	 */
+	uint32_t appendImage(const uint8_t *pImage, uint64_t length, uint32_t id) {
+		assert(outf);
+
+		alignOutput();
+
+		sliceFileEntry_t entry;
+		entry.offset = (uint64_t) ftello(outf);
+		entry.length = length;
+		entry.id     = id;
+		entry.unused = 0;
+
+		if (length)
+			fwrite(pImage, length, 1, outf);
+
+		newDirectory.push_back(entry);
+
+		return newDirectory.size() - 1;
+	}
+
+	/*
+	 * @date 2022-03-13 23:23:15
+	 *
+	 * Write directory, finalise header and close
+	 */
+	void close(void) {
+		assert(outf);
+
+		alignOutput();
+
+		sliceFileHeader_t header;
+		memset(&header, 0, sizeof header);
+
+		header.magic        = SLICEFILE_MAGIC;
+		header.numSlices    = newDirectory.size();
+		header.offDirectory = (uint64_t) ftello(outf);
+
+		if (!newDirectory.empty())
+			fwrite(newDirectory.data(), sizeof(sliceFileEntry_t), newDirectory.size(), outf);
+
+		header.offEnd = (uint64_t) ftello(outf);
+
+		// rewrite header
+		fseeko(outf, 0, SEEK_SET);
+		fwrite(&header, sizeof header, 1, outf);
+
+		// test for errors, most likely disk-full
+		if (feof(outf) || ferror(outf)) {
+			unlink(outFileName.c_str());
+			ctx.fatal("[ferror(%s,\"w\") returned: %m]\n", outFileName.c_str());
+		}
+
+		if (fclose(outf)) {
+			unlink(outFileName.c_str());
+			ctx.fatal("[fclose(%s,\"w\") returned: %m]\n", outFileName.c_str());
+		}
+
+		outf = NULL;
+		newDirectory.clear();
+	}
+
+	/*
+	 * Pad output to 64 bytes so images start on a cache line
+	 */
+	void alignOutput(void) {
+		static const uint8_t zero64[64] = {0};
+
+		size_t fillLen = 64 - ((uint64_t) ftello(outf) & 63);
+		if (fillLen < 64)
+			fwrite(zero64, fillLen, 1, outf);
+	}
+};
+
+#endif